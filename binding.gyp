@@ -3,7 +3,18 @@
     {
       "target_name": "native_module",
       "sources": [
-        "cpp/native-module.cpp"
+        "cpp/native-module.cpp",
+        "cpp/native-module-linalg.cpp",
+        "cpp/native-module-sparse.cpp",
+        "cpp/native-module-control.cpp",
+        "cpp/native-module-interp.cpp",
+        "cpp/native-module-poly.cpp",
+        "cpp/native-module-fft.cpp",
+        "cpp/native-module-signal.cpp",
+        "cpp/native-module-stats.cpp",
+        "cpp/native-module-sort.cpp",
+        "cpp/native-module-random.cpp",
+        "cpp/native-module-ndarray.cpp"
       ],
       "include_dirs": [
         "<!@(node -p \"require('node-addon-api').include\")",
@@ -15,13 +26,20 @@
       "cflags_cc!": [
         "-fno-exceptions"
       ],
+      "cflags_cc": [
+        "-fopenmp"
+      ],
+      "ldflags": [
+        "-fopenmp"
+      ],
       "defines": [
         "NAPI_DISABLE_CPP_EXCEPTIONS"
       ],
       "msvs_settings": {
         "VCCLCompilerTool": {
           "AdditionalOptions": [
-            "-std:c++17"
+            "-std:c++17",
+            "/openmp"
           ]
         }
       }
@@ -70,6 +88,97 @@
           ]
         }
       }
+    },
+    {
+      "target_name": "alpha_shape_2d",
+      "sources": [
+        "cpp/alpha-shape-2d.cpp"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")",
+        "<(module_root_dir)/lib/cgal-6.0.1/include/",
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/include",
+        "<(module_root_dir)/lib/boost-1.86.0/"
+      ],
+      "libraries": [
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/lib/gmp.lib",
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/lib/mpfr.lib"
+      ],
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions",
+        "-O3",
+        "-DNDEBUG"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "copies": [
+        {
+          "destination": "<(module_root_dir)/build/Release",
+          "files": [
+            "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/bin/gmp-10.dll",
+            "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/bin/mpfr-6.dll"
+          ]
+        }
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "AdditionalOptions": [
+            "-std:c++17",
+            "/GR",
+            "/EHsc"
+          ]
+        }
+      }
+    },
+    {
+      "target_name": "scattered_interpolant_2d",
+      "sources": [
+        "cpp/scattered-interpolant-2d.cpp"
+      ],
+      "include_dirs": [
+        "<!@(node -p \"require('node-addon-api').include\")",
+        "<(module_root_dir)/lib/cgal-6.0.1/include/",
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/include",
+        "<(module_root_dir)/lib/boost-1.86.0/",
+        "<(module_root_dir)/lib/eigen-3.4.0/"
+      ],
+      "libraries": [
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/lib/gmp.lib",
+        "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/lib/mpfr.lib"
+      ],
+      "cflags!": [
+        "-fno-exceptions"
+      ],
+      "cflags_cc!": [
+        "-fno-exceptions",
+        "-O3",
+        "-DNDEBUG"
+      ],
+      "defines": [
+        "NAPI_DISABLE_CPP_EXCEPTIONS"
+      ],
+      "copies": [
+        {
+          "destination": "<(module_root_dir)/build/Release",
+          "files": [
+            "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/bin/gmp-10.dll",
+            "<(module_root_dir)/lib/cgal-6.0.1/auxiliary/gmp/bin/mpfr-6.dll"
+          ]
+        }
+      ],
+      "msvs_settings": {
+        "VCCLCompilerTool": {
+          "AdditionalOptions": [
+            "-std:c++17",
+            "/GR",
+            "/EHsc"
+          ]
+        }
+      }
     }
   ]
 }
\ No newline at end of file
@@ -0,0 +1,532 @@
+// AlphaShape2D - alpha-shape-2d.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "alpha-shape-2d.h"
+
+namespace alpha_shape_2d_ns {
+
+#ifdef PROFILE_ALPHA_SHAPE_2D
+// Function to start the timer and return the start time
+time_point<steady_clock> tic() {
+  return steady_clock::now();
+}
+
+// Function to stop the timer and return the elapsed time
+long toc(const time_point<steady_clock>& startTime) {
+  return duration_cast<milliseconds>(steady_clock::now() - startTime).count();
+}
+#endif
+
+// Function to get current time
+std::string getCurrentTime() {
+  // get current time
+  auto now = system_clock::now();
+
+  // get number of milliseconds for the current second
+  // (remainder after division into seconds)
+  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
+
+  // convert to std::time_t in order to convert to std::tm (broken time)
+  auto timer = system_clock::to_time_t(now);
+
+  // convert to broken time
+  std::tm bt = *std::localtime(&timer);
+
+  std::ostringstream oss;
+
+  oss << std::put_time(&bt, "%H:%M:%S"); // HH:MM:SS
+  oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
+
+  return oss.str();
+}
+
+// Function to console log data
+int consoleLog(uint8_t level, const char* format, ...) {
+#ifdef DEBUG_ALPHA_SHAPE_2D_LEVEL
+  if(level <= DEBUG_ALPHA_SHAPE_2D_LEVEL) {
+    printf("\033[0;33m[%s AlphaShape2D]\033[0m ", getCurrentTime().c_str());
+    va_list vl;
+    va_start(vl, format);
+    auto ret = vprintf(format, vl);
+    va_end(vl);
+    printf("\n");
+    return ret;
+  }
+#endif
+  return 0;
+}
+
+// AlphaShape2D()
+// Object constructor
+// --------------------
+AlphaShape2D::AlphaShape2D(const Napi::CallbackInfo& info) : Napi::ObjectWrap<AlphaShape2D>(info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called constructor");
+#endif
+  this->alphaShape = nullptr;
+  this->delaunayTriangulation = nullptr;
+  this->numAlphaValues = 0;
+}
+
+// ~AlphaShape2D()
+// Object destructor
+// --------------------
+AlphaShape2D::~AlphaShape2D(void) {
+  if(this->delaunayTriangulation){
+    delete this->delaunayTriangulation;
+    this->delaunayTriangulation = nullptr;
+  }
+  if(this->alphaShape){
+    delete this->alphaShape;
+    this->alphaShape = nullptr;
+  }
+}
+
+// Init() function
+// --------------------
+Napi::Object AlphaShape2D::Init(Napi::Env env, Napi::Object exports) {
+  Napi::Function func = DefineClass(env, "AlphaShape2D", {
+    InstanceMethod("newShape", &AlphaShape2D::NewShapeJS),
+    InstanceMethod("getAlpha", &AlphaShape2D::GetAlphaJS),
+    InstanceMethod("setAlpha", &AlphaShape2D::SetAlphaJS),
+    InstanceMethod("getNumRegions", &AlphaShape2D::GetNumRegionsJS),
+    InstanceMethod("getAlphaSpectrum", &AlphaShape2D::GetAlphaSpectrumJS),
+    InstanceMethod("getCriticalAlpha", &AlphaShape2D::GetCriticalAlphaJS),
+    InstanceMethod("getArea", &AlphaShape2D::GetAreaJS),
+    InstanceMethod("getPerimeter", &AlphaShape2D::GetPerimeterJS),
+    InstanceMethod("getBoundaryPolylines", &AlphaShape2D::GetBoundaryPolylinesJS),
+    InstanceMethod("checkInShape", &AlphaShape2D::CheckInShapeJS)
+  });
+  Napi::FunctionReference* constructor = new Napi::FunctionReference();
+  *constructor = Napi::Persistent(func);
+  env.SetInstanceData(constructor);
+
+  exports.Set("AlphaShape2D", func);
+  return exports;
+}
+
+// hasShape() function
+// --------------------
+bool AlphaShape2D::hasShape(Napi::Env env) {
+  if(!this->alphaShape){
+    Napi::Error::New(env, "Shape is not created, call newShape first").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// NewShapeJS() function
+// --------------------
+void AlphaShape2D::NewShapeJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called NewShapeJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of points [x0, y0, x1, y1, ...] expected").ThrowAsJavaScriptException();
+    return;
+  }
+
+  Napi::Float64Array jsPoints = info[0].As<Napi::Float64Array>();
+  if(jsPoints.ElementLength() % 2 != 0){
+    Napi::RangeError::New(env, "Number of coordinates should be a multiple of 2").ThrowAsJavaScriptException();
+    return;
+  }
+  if(jsPoints.ElementLength() < 6){
+    Napi::RangeError::New(env, "At least 3 points are required").ThrowAsJavaScriptException();
+    return;
+  }
+
+  this->newShape(jsPoints.Data(), jsPoints.ElementLength() / 2);
+}
+
+// GetAlphaJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetAlphaJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetAlphaJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  return Napi::Number::New(env, this->getAlpha());
+}
+
+// SetAlphaJS() function
+// --------------------
+void AlphaShape2D::SetAlphaJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called SetAlphaJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsNumber()){
+    Napi::TypeError::New(env, "Number expected").ThrowAsJavaScriptException();
+    return;
+  }
+  if(!this->hasShape(env)){
+    return;
+  }
+  this->setAlpha(info[0].As<Napi::Number>().DoubleValue());
+}
+
+// GetNumRegionsJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetNumRegionsJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetNumRegionsJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  return Napi::Number::New(env, this->numRegions());
+}
+
+// GetAlphaSpectrumJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetAlphaSpectrumJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetAlphaSpectrumJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  std::vector<double> spectrum = this->getAlphaSpectrum();
+  Napi::Float64Array result = Napi::Float64Array::New(env, spectrum.size());
+  std::copy(spectrum.begin(), spectrum.end(), result.Data());
+  return result;
+}
+
+// GetCriticalAlphaJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetCriticalAlphaJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetCriticalAlphaJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsString()){
+    Napi::TypeError::New(env, "String expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  std::string type = info[0].As<Napi::String>().Utf8Value();
+  return Napi::Number::New(env, this->getCriticalAlpha(type));
+}
+
+// GetAreaJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetAreaJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetAreaJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  return Napi::Number::New(env, this->getArea());
+}
+
+// GetPerimeterJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetPerimeterJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetPerimeterJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+  return Napi::Number::New(env, this->getPerimeter());
+}
+
+// GetBoundaryPolylinesJS() function
+// --------------------
+Napi::Value AlphaShape2D::GetBoundaryPolylinesJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called GetBoundaryPolylinesJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+
+  std::vector<uint32_t> indices;
+  std::vector<uint32_t> offsets;
+  this->getBoundaryPolylines(indices, offsets);
+
+  Napi::Uint32Array jsIndices = Napi::Uint32Array::New(env, indices.size());
+  Napi::Uint32Array jsOffsets = Napi::Uint32Array::New(env, offsets.size());
+  std::copy(indices.begin(), indices.end(), jsIndices.Data());
+  std::copy(offsets.begin(), offsets.end(), jsOffsets.Data());
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("indices", jsIndices);
+  jsResult.Set("offsets", jsOffsets);
+  return jsResult;
+}
+
+// CheckInShapeJS() function
+// --------------------
+Napi::Value AlphaShape2D::CheckInShapeJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called CheckInShapeJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of query points [x0, y0, x1, y1, ...] expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!this->hasShape(env)){
+    return env.Null();
+  }
+
+  Napi::Float64Array QP = info[0].As<Napi::Float64Array>();
+  uint32_t n = QP.ElementLength() / 2;
+  Napi::Uint8Array jsResult = Napi::Uint8Array::New(env, n);
+  this->checkInShape(QP.Data(), n, jsResult.Data());
+  return jsResult;
+}
+
+// newShape() function
+// --------------------
+void AlphaShape2D::newShape(const double* P, uint32_t n) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called newShape()");
+#endif
+
+  // Clear existing data to prevent accumulation
+  this->Points.clear();
+  this->Vertices.clear();
+  this->Points.reserve(n);
+  this->Vertices.reserve(n);
+
+  for(uint32_t i = 0; i < n; i++){
+    this->Points.emplace_back(P[2*i], P[2*i+1]);
+    this->Vertices.emplace_back(this->Points.back(), i);
+  }
+
+  // Delete existing triangulation and alphaShape to prevent memory leaks
+  if(this->delaunayTriangulation){
+    delete this->delaunayTriangulation;
+    this->delaunayTriangulation = nullptr;
+  }
+  if(this->alphaShape){
+    delete this->alphaShape;
+    this->alphaShape = nullptr;
+  }
+
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  std::cout << "Computing delaunay triangulation of " << n << " points." << std::endl;
+#endif
+
+  this->delaunayTriangulation = new Dt(this->Vertices.begin(), this->Vertices.end());
+  this->alphaShape = new As2(*this->delaunayTriangulation, 0, As2::GENERAL);
+  this->numAlphaValues = this->alphaShape->number_of_alphas();
+
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  std::cout << "Number of alpha values is "
+            << this->numAlphaValues << std::endl;
+#endif
+}
+
+// getAlpha() function
+// --------------------
+double AlphaShape2D::getAlpha(void) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getAlpha()");
+#endif
+
+  return this->alphaShape->get_alpha();
+}
+
+// setAlpha() function
+// --------------------
+void AlphaShape2D::setAlpha(double alpha) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called setAlpha()");
+#endif
+
+  this->alphaShape->set_alpha(alpha);
+}
+
+// numRegions() function
+// --------------------
+double AlphaShape2D::numRegions(void) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called numRegions()");
+#endif
+
+  return this->alphaShape->number_of_solid_components();
+}
+
+// getAlphaSpectrum() function
+// --------------------
+std::vector<double> AlphaShape2D::getAlphaSpectrum(void) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getAlphaSpectrum()");
+#endif
+
+  std::vector<double> a(this->numAlphaValues);
+  for(std::size_t i = 0; i < this->numAlphaValues; i++){
+    a[i] = this->alphaShape->get_nth_alpha(i + 1);
+  }
+  return a;
+}
+
+// getCriticalAlpha() function
+// --------------------
+double AlphaShape2D::getCriticalAlpha(std::string type) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getCriticalAlpha()");
+#endif
+
+  if(type == "all-points"){
+    return this->alphaShape->find_alpha_solid();
+  }
+  else if(type == "one-region"){
+    As2::Alpha_iterator it = this->alphaShape->find_optimal_alpha(1);
+    if(it == this->alphaShape->alpha_end()){
+      return nan("");
+    }
+    return *it;
+  }
+  else{
+    return nan("");
+  }
+}
+
+// getArea() function
+// --------------------
+double AlphaShape2D::getArea(void) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getArea()");
+#endif
+
+  double area = 0;
+  for(As2::Finite_faces_iterator fit = this->alphaShape->finite_faces_begin();
+      fit != this->alphaShape->finite_faces_end(); ++fit){
+    if(this->alphaShape->classify(fit) == As2::INTERIOR){
+      area += this->alphaShape->triangle(fit).area();
+    }
+  }
+  return area;
+}
+
+// getPerimeter() function
+// --------------------
+double AlphaShape2D::getPerimeter(void) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getPerimeter()");
+#endif
+
+  double perimeter = 0;
+  for(As2::Finite_edges_iterator eit = this->alphaShape->finite_edges_begin();
+      eit != this->alphaShape->finite_edges_end(); ++eit){
+    if(this->alphaShape->classify(*eit) == As2::REGULAR){
+      perimeter += std::sqrt(this->alphaShape->segment(*eit).squared_length());
+    }
+  }
+  return perimeter;
+}
+
+// getBoundaryPolylines() function
+// Regular edges are oriented with the interior on the left side and chained
+// into closed loops (first index repeated at the end), singular edges are
+// returned as separate two point polylines.
+// --------------------
+void AlphaShape2D::getBoundaryPolylines(std::vector<uint32_t>& indices,
+    std::vector<uint32_t>& offsets) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called getBoundaryPolylines()");
+#endif
+
+  std::multimap<uint32_t, uint32_t> next;
+  std::vector<std::pair<uint32_t, uint32_t>> singular;
+
+  for(As2::Finite_edges_iterator eit = this->alphaShape->finite_edges_begin();
+      eit != this->alphaShape->finite_edges_end(); ++eit){
+    As2::Classification_type type = this->alphaShape->classify(*eit);
+    As2::Face_handle f = eit->first;
+    int i = eit->second;
+    if(type == As2::REGULAR){
+      if(this->alphaShape->classify(f) != As2::INTERIOR){
+        As2::Face_handle n = f->neighbor(i);
+        i = n->index(f);
+        f = n;
+      }
+      next.emplace(f->vertex(this->alphaShape->ccw(i))->info(), f->vertex(this->alphaShape->cw(i))->info());
+    }
+    else if(type == As2::SINGULAR){
+      singular.emplace_back(f->vertex(this->alphaShape->ccw(i))->info(), f->vertex(this->alphaShape->cw(i))->info());
+    }
+  }
+
+  offsets.clear();
+  indices.clear();
+  offsets.push_back(0);
+  while(!next.empty()){
+    auto it = next.begin();
+    uint32_t start = it->first;
+    uint32_t current = it->second;
+    next.erase(it);
+    indices.push_back(start);
+    while(current != start){
+      indices.push_back(current);
+      it = next.find(current);
+      if(it == next.end()){
+        break;
+      }
+      current = it->second;
+      next.erase(it);
+    }
+    if(current == start){
+      indices.push_back(start);
+    }
+    offsets.push_back(indices.size());
+  }
+
+  for(const auto& e : singular){
+    indices.push_back(e.first);
+    indices.push_back(e.second);
+    offsets.push_back(indices.size());
+  }
+}
+
+// checkInShape() function
+// --------------------
+void AlphaShape2D::checkInShape(const double* QP, uint32_t n, uint8_t* tf) {
+#ifdef DEBUG_ALPHA_SHAPE_2D
+  consoleLog(0, "Called checkInShape()");
+#endif
+
+  for(uint32_t i = 0; i < n; i++){
+    tf[i] = this->alphaShape->classify(Point(QP[2*i], QP[2*i+1])) != As2::EXTERIOR;
+  }
+}
+
+Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
+  return AlphaShape2D::Init(env, exports);
+}
+
+NODE_API_MODULE(NODE_GYP_MODULE_NAME, InitAll)
+
+}  // namespace alpha_shape_2d_ns
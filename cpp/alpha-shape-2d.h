@@ -0,0 +1,93 @@
+// AlphaShape2D - alpha-shape-2d.h
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#ifndef ALPHA_SHAPE_2D_H
+#define ALPHA_SHAPE_2D_H
+
+//#define DEBUG_ALPHA_SHAPE_2D
+//#define DEBUG_ALPHA_SHAPE_2D_LEVEL 0
+//#define PROFILE_ALPHA_SHAPE_2D
+
+#include <napi.h>
+#include <chrono>
+#include <thread>
+#include <Windows.h>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include <cassert>
+#include <list>
+#include <vector>
+#include <map>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+#include <CGAL/Alpha_shape_2.h>
+#include <CGAL/Alpha_shape_vertex_base_2.h>
+#include <CGAL/Alpha_shape_face_base_2.h>
+
+namespace alpha_shape_2d_ns {
+
+using namespace std;
+using namespace std::chrono;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Gt;
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<unsigned, Gt> Tvb;
+typedef CGAL::Alpha_shape_vertex_base_2<Gt, Tvb> Vb;
+typedef CGAL::Alpha_shape_face_base_2<Gt> Fb;
+typedef CGAL::Triangulation_data_structure_2<Vb, Fb> Tds;
+typedef CGAL::Delaunay_triangulation_2<Gt, Tds> Dt;
+typedef Dt::Point Point;
+
+typedef CGAL::Alpha_shape_2<Dt> As2;
+
+class AlphaShape2D : public Napi::ObjectWrap<AlphaShape2D> {
+ public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports);
+  AlphaShape2D(const Napi::CallbackInfo& info);
+  ~AlphaShape2D();
+
+  std::vector<Point> Points;
+  std::vector<std::pair<Point, unsigned>> Vertices;
+  void newShape(const double*, uint32_t);
+  double getAlpha(void);
+  void setAlpha(double);
+  double numRegions(void);
+  std::vector<double> getAlphaSpectrum(void);
+  double getCriticalAlpha(std::string);
+  double getArea(void);
+  double getPerimeter(void);
+  void getBoundaryPolylines(std::vector<uint32_t>&, std::vector<uint32_t>&);
+  void checkInShape(const double*, uint32_t, uint8_t*);
+
+  // JavaScript wrapper methods
+  void NewShapeJS(const Napi::CallbackInfo& info);
+  Napi::Value GetAlphaJS(const Napi::CallbackInfo& info);
+  void SetAlphaJS(const Napi::CallbackInfo& info);
+  Napi::Value GetNumRegionsJS(const Napi::CallbackInfo& info);
+  Napi::Value GetAlphaSpectrumJS(const Napi::CallbackInfo& info);
+  Napi::Value GetCriticalAlphaJS(const Napi::CallbackInfo& info);
+  Napi::Value GetAreaJS(const Napi::CallbackInfo& info);
+  Napi::Value GetPerimeterJS(const Napi::CallbackInfo& info);
+  Napi::Value GetBoundaryPolylinesJS(const Napi::CallbackInfo& info);
+  Napi::Value CheckInShapeJS(const Napi::CallbackInfo& info);
+
+private:
+  bool hasShape(Napi::Env env);
+
+  As2 *alphaShape;
+  Dt *delaunayTriangulation;
+  std::size_t numAlphaValues;
+};
+
+}// namespace alpha_shape_2d_ns
+
+#endif // ALPHA_SHAPE_2D_H
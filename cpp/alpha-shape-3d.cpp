@@ -20,39 +20,14 @@ long toc(const time_point<steady_clock>& startTime) {
 }
 #endif
 
-// Function to get current time
-std::string getCurrentTime() {
-  // get current time
-  auto now = system_clock::now();
-
-  // get number of milliseconds for the current second
-  // (remainder after division into seconds)
-  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-
-  // convert to std::time_t in order to convert to std::tm (broken time)
-  auto timer = system_clock::to_time_t(now);
-
-  // convert to broken time
-  std::tm bt = *std::localtime(&timer);
-
-  std::ostringstream oss;
-
-  oss << std::put_time(&bt, "%H:%M:%S"); // HH:MM:SS
-  oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-
-  return oss.str();
-}
-
 // Function to console log data
 int consoleLog(uint8_t level, const char* format, ...) {
-#ifdef DEBUG_SOLVER_MP_6RSS_LEVEL
-  if(level <= DEBUG_SOLVER_MP_6RSS_LEVEL) {
-    printf("\033[0;33m[%s SolverMP6RSS]\033[0m ", getCurrentTime().c_str());
+#ifdef DEBUG_ALPHA_SHAPE_3D_LEVEL
+  if(level <= DEBUG_ALPHA_SHAPE_3D_LEVEL) {
     va_list vl;
     va_start(vl, format);
-    auto ret = vprintf(format, vl);
+    auto ret = consoleLogV("AlphaShape3D", format, vl);
     va_end(vl);
-    printf("\n");
     return ret;
   }
 #endif
@@ -68,6 +43,8 @@ AlphaShape3D::AlphaShape3D(const Napi::CallbackInfo& info) : Napi::ObjectWrap<Al
 #endif
   this->alphaShape = nullptr;
   this->delaunayTriangulation = nullptr;
+  this->gridCellSize = 0;
+  this->alphaSet = false;
 }
 
 // ~AlphaShape3D()
@@ -99,11 +76,16 @@ Napi::Object AlphaShape3D::Init(Napi::Env env, Napi::Object exports) {
     InstanceMethod("getBoundaryFacets", &AlphaShape3D::GetBoundaryFacetsJS),
     InstanceMethod("writeBoundaryFacets", &AlphaShape3D::WriteBoundaryFacetsJS),
     InstanceMethod("checkInShape", &AlphaShape3D::CheckInShapeJS),
-    InstanceMethod("writeOff", &AlphaShape3D::WriteOffJS),
     InstanceMethod("getTriangulation", &AlphaShape3D::GetTriangulationJS),
     InstanceMethod("getNearestNeighbor", &AlphaShape3D::GetNearestNeighborJS),
     InstanceMethod("getSimplifiedShape", &AlphaShape3D::GetSimplifiedShapeJS),
-    InstanceMethod("removeUnusedPoints", &AlphaShape3D::RemoveUnusedPointsJS)
+    InstanceMethod("removeUnusedPoints", &AlphaShape3D::RemoveUnusedPointsJS),
+    InstanceMethod("slice", &AlphaShape3D::SliceJS),
+    InstanceMethod("buildOccupancyGrid", &AlphaShape3D::BuildOccupancyGridJS),
+    InstanceMethod("clearOccupancyGrid", &AlphaShape3D::ClearOccupancyGridJS),
+    InstanceMethod("getRenderBuffers", &AlphaShape3D::GetRenderBuffersJS),
+    StaticMethod("writeOff", &AlphaShape3D::WriteOffJS),
+    StaticMethod("estimateNormals", &AlphaShape3D::EstimateNormalsJS)
   });
   Napi::FunctionReference* constructor = new Napi::FunctionReference();
   *constructor = Napi::Persistent(func);
@@ -133,6 +115,7 @@ void AlphaShape3D::NewShapeJS(const Napi::CallbackInfo& info) {
   this->inputPoints.resize(0, 0);
   this->Points.clear();
   this->Vertices.clear();
+  this->clearOccupancyGrid();
 
   // Initialize inputPoints matrix
   this->inputPoints.resize(numPoints, 3);
@@ -218,6 +201,7 @@ void AlphaShape3D::NewShapeJS(const Napi::CallbackInfo& info) {
   std::cout << "Computing alpha shapes." << std::endl;
 #endif
   this->alphaShape = new As3(*this->delaunayTriangulation, As3::GENERAL);
+  this->alphaSet = false;
 
   this->numAlphaValues = this->alphaShape->number_of_alphas();
 
@@ -378,6 +362,14 @@ Napi::Value AlphaShape3D::CheckInShapeJS(const Napi::CallbackInfo& info) {
 #endif
 
   Napi::Env env = info.Env();
+  if(info.Length() >= 1 && info[0].IsTypedArray() && 
+      info[0].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array){
+    Napi::Float64Array QP = info[0].As<Napi::Float64Array>();
+    uint32_t n = QP.ElementLength() / 3;
+    Napi::Uint8Array jsResult = Napi::Uint8Array::New(env, n);
+    this->checkInShape(QP.Data(), n, jsResult.Data());
+    return jsResult;
+  }
   if(info.Length() < 1 || !info[0].IsArray()){
     Napi::TypeError::New(env, "Array expected").ThrowAsJavaScriptException();
     return env.Null();
@@ -398,6 +390,150 @@ Napi::Value AlphaShape3D::CheckInShapeJS(const Napi::CallbackInfo& info) {
   return jsResult;
 }
 
+// BuildOccupancyGridJS() function
+// --------------------
+Napi::Value AlphaShape3D::BuildOccupancyGridJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called BuildOccupancyGridJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  uint32_t resolution = 64;
+  if(info.Length() >= 1 && !info[0].IsUndefined()){
+    double value = info[0].IsNumber() ? info[0].As<Napi::Number>().DoubleValue() : 0;
+    if(!(value >= 1 && value <= 256)){
+      Napi::RangeError::New(env, "Number of cells between 1 and 256 expected").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    resolution = info[0].As<Napi::Number>().Uint32Value();
+  }
+  if(!this->alphaShape){
+    Napi::Error::New(env, "Shape is not created, call newShape first").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  this->buildOccupancyGrid(resolution);
+
+  std::size_t counts[3] = {0, 0, 0};
+  for(uint8_t label : this->occupancyGrid){
+    counts[label]++;
+  }
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  Napi::Array dims = Napi::Array::New(env, 3);
+  for(uint32_t i = 0; i < 3; i++){
+    dims.Set(i, Napi::Number::New(env, this->gridDims[i]));
+  }
+  jsResult.Set("dims", dims);
+  jsResult.Set("cellSize", Napi::Number::New(env, this->gridCellSize));
+  jsResult.Set("outside", Napi::Number::New(env, counts[0]));
+  jsResult.Set("inside", Napi::Number::New(env, counts[1]));
+  jsResult.Set("boundary", Napi::Number::New(env, counts[2]));
+  return jsResult;
+}
+
+// ClearOccupancyGridJS() function
+// --------------------
+void AlphaShape3D::ClearOccupancyGridJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called ClearOccupancyGridJS()");
+#endif
+
+  this->clearOccupancyGrid();
+}
+
+// EstimateNormalsJS() function
+// --------------------
+Napi::Value AlphaShape3D::EstimateNormalsJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called EstimateNormalsJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  std::vector<Point> points;
+  if(info.Length() >= 1 && info[0].IsTypedArray() && 
+      info[0].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array){
+    Napi::Float64Array jsPoints = info[0].As<Napi::Float64Array>();
+    if(jsPoints.ElementLength() % 3 != 0){
+      Napi::RangeError::New(env, "Number of coordinates should be a multiple of 3").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    const double* c = jsPoints.Data();
+    points.reserve(jsPoints.ElementLength() / 3);
+    for(size_t i = 0; i < jsPoints.ElementLength() / 3; i++){
+      points.emplace_back(c[3*i], c[3*i+1], c[3*i+2]);
+    }
+  }
+  else if(info.Length() >= 1 && info[0].IsArray()){
+    Napi::Array jsArray = info[0].As<Napi::Array>();
+    points.reserve(jsArray.Length());
+    for(size_t i = 0; i < jsArray.Length(); i++){
+      Napi::Array point = jsArray.Get(i).As<Napi::Array>();
+      points.emplace_back(point.Get((uint32_t)0).As<Napi::Number>().DoubleValue(),
+        point.Get(1).As<Napi::Number>().DoubleValue(),
+        point.Get(2).As<Napi::Number>().DoubleValue());
+    }
+  }
+  else{
+    Napi::TypeError::New(env, "Array of points or Float64Array expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  uint32_t k = 18;
+  if(info.Length() >= 2 && !info[1].IsUndefined()){
+    if(!info[1].IsNumber() || info[1].As<Napi::Number>().DoubleValue() < 3){
+      Napi::RangeError::New(env, "Number of neighbors should be at least 3").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    k = info[1].As<Napi::Number>().Uint32Value();
+  }
+  bool orient = true;
+  if(info.Length() >= 3 && !info[2].IsUndefined()){
+    orient = info[2].ToBoolean().Value();
+  }
+
+  std::vector<Gt::Vector_3> normals = estimateNormals(points, k, orient);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, normals.size() * 3);
+  for(size_t i = 0; i < normals.size(); i++){
+    jsResult[3*i] = normals[i].x();
+    jsResult[3*i+1] = normals[i].y();
+    jsResult[3*i+2] = normals[i].z();
+  }
+  return jsResult;
+}
+
+// GetRenderBuffersJS() function
+// --------------------
+Napi::Value AlphaShape3D::GetRenderBuffersJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called GetRenderBuffersJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->alphaShape){
+    Napi::Error::New(env, "Shape is not created, call newShape first").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  RenderBuffers buffers = this->getRenderBuffers();
+
+  Napi::Float32Array positions = Napi::Float32Array::New(env, buffers.positions.size());
+  Napi::Float32Array normals = Napi::Float32Array::New(env, buffers.normals.size());
+  Napi::Uint32Array indices = Napi::Uint32Array::New(env, buffers.indices.size());
+  Napi::Uint32Array pointIndices = Napi::Uint32Array::New(env, buffers.pointIndices.size());
+  std::copy(buffers.positions.begin(), buffers.positions.end(), positions.Data());
+  std::copy(buffers.normals.begin(), buffers.normals.end(), normals.Data());
+  std::copy(buffers.indices.begin(), buffers.indices.end(), indices.Data());
+  std::copy(buffers.pointIndices.begin(), buffers.pointIndices.end(), pointIndices.Data());
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("positions", positions);
+  jsResult.Set("normals", normals);
+  jsResult.Set("indices", indices);
+  jsResult.Set("pointIndices", pointIndices);
+  return jsResult;
+}
+
 // WriteOffJS() function
 // --------------------
 void AlphaShape3D::WriteOffJS(const Napi::CallbackInfo& info) {
@@ -408,6 +544,7 @@ void AlphaShape3D::WriteOffJS(const Napi::CallbackInfo& info) {
   Napi::Env env = info.Env();
   if(info.Length() < 3 || !info[0].IsString() || !info[1].IsArray() || !info[2].IsArray()){
     Napi::TypeError::New(env, "Expected arguments: filename (string), points (array), facets (array)").ThrowAsJavaScriptException();
+    return;
   }
 
   std::string filename = info[0].As<Napi::String>().Utf8Value();
@@ -431,7 +568,7 @@ void AlphaShape3D::WriteOffJS(const Napi::CallbackInfo& info) {
     }
   }
 
-  this->writeOff(filename, Points, bf);
+  writeOff(filename, Points, bf);
 }
 
 // GetTriangulationJS() function
@@ -614,6 +751,84 @@ Napi::Value AlphaShape3D::RemoveUnusedPointsJS(const Napi::CallbackInfo& info) {
   return jsResult;
 }  
 
+// SliceJS() function
+// --------------------
+Napi::Value AlphaShape3D::SliceJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called SliceJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(!this->alphaShape || !this->alphaSet){
+    Napi::Error::New(env, "Alpha is not set, call setAlpha first").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<Gt::Plane_3> planes;
+  if(info.Length() >= 1 && info[0].IsTypedArray() && 
+      info[0].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array){
+    Napi::Float64Array jsPlanes = info[0].As<Napi::Float64Array>();
+    if(jsPlanes.ElementLength() % 4 != 0){
+      Napi::RangeError::New(env, "Number of plane coefficients should be a multiple of 4").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    const double* c = jsPlanes.Data();
+    for(size_t i = 0; i < jsPlanes.ElementLength() / 4; i++){
+      planes.emplace_back(c[4*i], c[4*i+1], c[4*i+2], c[4*i+3]);
+    }
+  }
+  else if(info.Length() >= 1 && info[0].IsArray()){
+    Napi::Array jsPlanes = info[0].As<Napi::Array>();
+    for(size_t i = 0; i < jsPlanes.Length(); i++){
+      Napi::Value plane = jsPlanes.Get(i);
+      if(!plane.IsArray() || plane.As<Napi::Array>().Length() != 4){
+        Napi::TypeError::New(env, "Each plane should be an array [a, b, c, d]").ThrowAsJavaScriptException();
+        return env.Null();
+      }
+      Napi::Array p = plane.As<Napi::Array>();
+      planes.emplace_back(p.Get((uint32_t)0).As<Napi::Number>().DoubleValue(),
+        p.Get(1).As<Napi::Number>().DoubleValue(),
+        p.Get(2).As<Napi::Number>().DoubleValue(),
+        p.Get(3).As<Napi::Number>().DoubleValue());
+    }
+  }
+  else{
+    Napi::TypeError::New(env, "Array of planes [a, b, c, d] or Float64Array expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  for(const Gt::Plane_3& plane : planes){
+    if(plane.is_degenerate()){
+      Napi::RangeError::New(env, "Plane normal can not be zero").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+
+  std::vector<SliceResult> result = this->slice(planes);
+
+  Napi::Array jsResult = Napi::Array::New(env, result.size());
+  for(size_t k = 0; k < result.size(); k++){
+    Napi::Object jsSlice = Napi::Object::New(env);
+    Napi::Array polylines = Napi::Array::New(env, result[k].polylines.size());
+    Napi::Float64Array areas = Napi::Float64Array::New(env, result[k].areas.size());
+    for(size_t i = 0; i < result[k].polylines.size(); i++){
+      const Polyline& pl = result[k].polylines[i];
+      Napi::Float64Array polyline = Napi::Float64Array::New(env, pl.size() * 3);
+      for(size_t j = 0; j < pl.size(); j++){
+        polyline[3*j] = pl[j].x();
+        polyline[3*j+1] = pl[j].y();
+        polyline[3*j+2] = pl[j].z();
+      }
+      polylines.Set(i, polyline);
+      areas[i] = result[k].areas[i];
+    }
+    jsSlice.Set("polylines", polylines);
+    jsSlice.Set("areas", areas);
+    jsSlice.Set("area", Napi::Number::New(env, result[k].area));
+    jsResult.Set(k, jsSlice);
+  }
+  return jsResult;
+}
+
 // getAlpha() function
 // --------------------
 double AlphaShape3D::getAlpha(void) {
@@ -632,7 +847,9 @@ void AlphaShape3D::setAlpha(double alpha) {
 #endif
 
   this->surface_mesh.clear();
+  this->clearOccupancyGrid();
   this->alphaShape->set_alpha(alpha);
+  this->alphaSet = true;
   
 #ifdef DEBUG_ALPHA_SHAPE_3D
   std::cout << "Number of solid components for alpha " << alpha
@@ -801,11 +1018,187 @@ Matrix AlphaShape3D::checkInShape(Matrix QP) {
 
   Matrix tf(QP.numRows(), 1);
   for(uint32_t i = 0; i < QP.numRows(); i++){
-    tf(i, 0) = this->alphaShape->classify(Point(QP(i, 0), QP(i, 1), QP(i, 2)));
+    tf(i, 0) = this->classifyPoint(QP(i, 0), QP(i, 1), QP(i, 2));
   }
   return tf;
 }
 
+// checkInShape() function for flat coordinates
+// --------------------
+void AlphaShape3D::checkInShape(const double* QP, uint32_t n, uint8_t* tf) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called checkInShape()");
+#endif
+
+  for(uint32_t i = 0; i < n; i++){
+    tf[i] = this->classifyPoint(QP[3*i], QP[3*i+1], QP[3*i+2]) != As3::EXTERIOR;
+  }
+}
+
+// classifyPoint() function
+// Uses occupancy grid when available, exact classification is done only 
+// for points in boundary cells. Points with NaN or infinite coordinates 
+// are exterior.
+// --------------------
+uint8_t AlphaShape3D::classifyPoint(double x, double y, double z) {
+  if(!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)){
+    return As3::EXTERIOR;
+  }
+  if(!this->occupancyGrid.empty()){
+    double c[3] = {x, y, z};
+    int64_t idx[3];
+    for(uint8_t k = 0; k < 3; k++){
+      idx[k] = (int64_t)std::floor((c[k] - this->gridOrigin[k]) / this->gridCellSize);
+      if(idx[k] < 0 || idx[k] >= this->gridDims[k]){
+        return As3::EXTERIOR;
+      }
+    }
+    uint8_t label = this->occupancyGrid[(idx[2] * this->gridDims[1] + idx[1]) * 
+      this->gridDims[0] + idx[0]];
+    if(label == 0){
+      return As3::EXTERIOR;
+    }
+    else if(label == 1){
+      return As3::INTERIOR;
+    }
+  }
+  return this->alphaShape->classify(Point(x, y, z));
+}
+
+// buildOccupancyGrid() function
+// Grid cells touched by regular or singular facets, singular edges and 
+// singular vertices are labeled as boundary, remaining cells are grouped 
+// into face connected regions and each region is classified once.
+// --------------------
+void AlphaShape3D::buildOccupancyGrid(uint32_t resolution) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called buildOccupancyGrid()");
+#endif
+
+  this->clearOccupancyGrid();
+  if(this->Points.empty() || resolution == 0){
+    return;
+  }
+
+  CGAL::Bbox_3 bbox = CGAL::bbox_3(this->Points.begin(), this->Points.end());
+  double lo[3] = {bbox.xmin(), bbox.ymin(), bbox.zmin()};
+  double hi[3] = {bbox.xmax(), bbox.ymax(), bbox.zmax()};
+  double extent = (std::max)({hi[0] - lo[0], hi[1] - lo[1], hi[2] - lo[2]});
+  if(extent <= 0){
+    extent = 1;
+  }
+  double pad = 1e-9 * extent;
+  this->gridCellSize = (extent + 2 * pad) / resolution;
+  for(uint8_t k = 0; k < 3; k++){
+    this->gridOrigin[k] = lo[k] - pad;
+    this->gridDims[k] = (std::max)((uint32_t)1, 
+      (uint32_t)std::ceil((hi[k] - lo[k] + 2 * pad) / this->gridCellSize));
+  }
+
+  const uint32_t nx = this->gridDims[0];
+  const uint32_t ny = this->gridDims[1];
+  const uint32_t nz = this->gridDims[2];
+  const double h = this->gridCellSize;
+  const double eps = 1e-6 * h;
+  std::vector<uint8_t> grid((std::size_t)nx * ny * nz, 255);
+
+  auto cellIndex = [&](double v, uint8_t k) {
+    int64_t i = (int64_t)std::floor((v - this->gridOrigin[k]) / h);
+    return (uint32_t)(std::min)((std::max)(i, (int64_t)0), (int64_t)this->gridDims[k] - 1);
+  };
+  auto cellBox = [&](uint32_t i, uint32_t j, uint32_t k) {
+    return CGAL::Bbox_3(
+      this->gridOrigin[0] + i * h - eps, this->gridOrigin[1] + j * h - eps, 
+      this->gridOrigin[2] + k * h - eps, this->gridOrigin[0] + (i + 1) * h + eps, 
+      this->gridOrigin[1] + (j + 1) * h + eps, this->gridOrigin[2] + (k + 1) * h + eps);
+  };
+  auto markCells = [&](const CGAL::Bbox_3& b, auto intersects) {
+    uint32_t i0 = cellIndex(b.xmin() - eps, 0), i1 = cellIndex(b.xmax() + eps, 0);
+    uint32_t j0 = cellIndex(b.ymin() - eps, 1), j1 = cellIndex(b.ymax() + eps, 1);
+    uint32_t k0 = cellIndex(b.zmin() - eps, 2), k1 = cellIndex(b.zmax() + eps, 2);
+    for(uint32_t k = k0; k <= k1; k++){
+      for(uint32_t j = j0; j <= j1; j++){
+        for(uint32_t i = i0; i <= i1; i++){
+          std::size_t c = ((std::size_t)k * ny + j) * nx + i;
+          if(grid[c] != 2 && intersects(cellBox(i, j, k))){
+            grid[c] = 2;
+          }
+        }
+      }
+    }
+  };
+
+  std::vector<As3::Facet> facets;
+  this->alphaShape->get_alpha_shape_facets(std::back_inserter(facets), As3::REGULAR);
+  this->alphaShape->get_alpha_shape_facets(std::back_inserter(facets), As3::SINGULAR);
+  for(const As3::Facet& f : facets){
+    Gt::Triangle_3 t = this->alphaShape->triangle(f);
+    markCells(t.bbox(), [&](const CGAL::Bbox_3& b){ return CGAL::do_intersect(b, t); });
+  }
+
+  std::vector<As3::Edge> edges;
+  this->alphaShape->get_alpha_shape_edges(std::back_inserter(edges), As3::SINGULAR);
+  for(const As3::Edge& e : edges){
+    Gt::Segment_3 sg = this->alphaShape->segment(e);
+    markCells(sg.bbox(), [&](const CGAL::Bbox_3& b){ return CGAL::do_intersect(b, sg); });
+  }
+
+  std::vector<As3::Vertex_handle> vertices;
+  this->alphaShape->get_alpha_shape_vertices(std::back_inserter(vertices), As3::SINGULAR);
+  for(const As3::Vertex_handle& v : vertices){
+    markCells(v->point().bbox(), [](const CGAL::Bbox_3&){ return true; });
+  }
+
+  // Flood fill of face connected regions
+  std::deque<std::size_t> queue;
+  for(std::size_t c0 = 0; c0 < grid.size(); c0++){
+    if(grid[c0] != 255){
+      continue;
+    }
+    uint32_t i = c0 % nx;
+    uint32_t j = (c0 / nx) % ny;
+    uint32_t k = c0 / ((std::size_t)nx * ny);
+    uint8_t label = this->alphaShape->classify(Point(
+      this->gridOrigin[0] + (i + 0.5) * h, this->gridOrigin[1] + (j + 0.5) * h, 
+      this->gridOrigin[2] + (k + 0.5) * h)) == As3::EXTERIOR ? 0 : 1;
+    grid[c0] = label;
+    queue.push_back(c0);
+    while(!queue.empty()){
+      std::size_t c = queue.front();
+      queue.pop_front();
+      i = c % nx;
+      j = (c / nx) % ny;
+      k = c / ((std::size_t)nx * ny);
+      std::size_t nb[6];
+      uint8_t m = 0;
+      if(i > 0) nb[m++] = c - 1;
+      if(i + 1 < nx) nb[m++] = c + 1;
+      if(j > 0) nb[m++] = c - nx;
+      if(j + 1 < ny) nb[m++] = c + nx;
+      if(k > 0) nb[m++] = c - (std::size_t)nx * ny;
+      if(k + 1 < nz) nb[m++] = c + (std::size_t)nx * ny;
+      for(uint8_t q = 0; q < m; q++){
+        if(grid[nb[q]] == 255){
+          grid[nb[q]] = label;
+          queue.push_back(nb[q]);
+        }
+      }
+    }
+  }
+
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  std::cout << "Occupancy grid " << nx << "x" << ny << "x" << nz 
+            << " built." << std::endl;
+#endif
+  this->occupancyGrid.swap(grid);
+}
+
+// clearOccupancyGrid() function
+// --------------------
+void AlphaShape3D::clearOccupancyGrid(void) {
+  std::vector<uint8_t>().swap(this->occupancyGrid);
+}
+
 // getTriangulation() function
 // --------------------
 Matrix AlphaShape3D::getTriangulation(void) {
@@ -981,6 +1374,209 @@ std::pair<Matrix, Matrix>
   return std::make_pair(Points, bf);
 }
 
+// slice() function
+// Boundary mesh is cut with all planes using one shared AABB tree, planes
+// are processed in parallel. Area of every closed polyline is computed in 
+// the plane and polylines nested in an odd number of other polylines are 
+// treated as holes in the total sectional area.
+// --------------------
+std::vector<SliceResult> AlphaShape3D::slice(const std::vector<Gt::Plane_3>& planes) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called slice()");
+#endif
+
+  std::vector<SliceResult> results(planes.size());
+  if(this->surface_mesh.number_of_faces() == 0){
+    for(SliceResult& r : results){
+      r.area = 0;
+    }
+    return results;
+  }
+
+  AABB_tree tree(edges(this->surface_mesh).first, 
+    edges(this->surface_mesh).second, this->surface_mesh);
+  tree.build();
+  Slicer slicer(this->surface_mesh, tree);
+
+  parallelFor(planes.size(), [&](std::size_t k){
+    const Gt::Plane_3& plane = planes[k];
+    SliceResult& r = results[k];
+    slicer(plane, std::back_inserter(r.polylines));
+
+    Gt::Vector_3 n = plane.orthogonal_vector();
+    n = n / std::sqrt(n.squared_length());
+
+    std::size_t np = r.polylines.size();
+    std::vector<bool> closed(np);
+    std::vector<std::vector<Gt::Point_2>> projected(np);
+    r.areas.assign(np, 0);
+    for(std::size_t i = 0; i < np; i++){
+      const Polyline& pl = r.polylines[i];
+      closed[i] = pl.size() > 3 && pl.front() == pl.back();
+      if(!closed[i]){
+        continue;
+      }
+      Gt::Vector_3 s = CGAL::NULL_VECTOR;
+      for(std::size_t j = 1; j + 1 < pl.size(); j++){
+        s = s + CGAL::cross_product(pl[j] - pl[0], pl[j+1] - pl[0]);
+      }
+      r.areas[i] = 0.5 * std::abs(s * n);
+      for(const Point& p : pl){
+        projected[i].push_back(plane.to_2d(p));
+      }
+    }
+
+    r.area = 0;
+    for(std::size_t i = 0; i < np; i++){
+      if(!closed[i]){
+        continue;
+      }
+      const Gt::Point_2& q = projected[i][0];
+      std::size_t depth = 0;
+      for(std::size_t j = 0; j < np; j++){
+        if(i == j || !closed[j]){
+          continue;
+        }
+        const std::vector<Gt::Point_2>& pj = projected[j];
+        bool inside = false;
+        for(std::size_t a = 0, b = pj.size() - 2; a + 1 < pj.size(); b = a++){
+          if(((pj[a].y() > q.y()) != (pj[b].y() > q.y())) &&
+              (q.x() < (pj[b].x() - pj[a].x()) * (q.y() - pj[a].y()) / 
+                (pj[b].y() - pj[a].y()) + pj[a].x())){
+            inside = !inside;
+          }
+        }
+        if(inside){
+          depth++;
+        }
+      }
+      r.area += (depth % 2 == 0) ? r.areas[i] : -r.areas[i];
+    }
+  });
+  return results;
+}
+
+// estimateNormals() function
+// Normal of every point is the eigenvector of the smallest eigenvalue of 
+// the covariance matrix of its k nearest neighbors. Neighborhoods are 
+// processed in parallel on a shared kd-tree, normals are optionally 
+// oriented by propagation along the minimum spanning tree of the 
+// neighborhood graph.
+// --------------------
+std::vector<Gt::Vector_3> AlphaShape3D::estimateNormals(
+    const std::vector<Point>& points, uint32_t k, bool orient) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called estimateNormals()");
+#endif
+
+  std::size_t n = points.size();
+  std::vector<Gt::Vector_3> normals(n, Gt::Vector_3(0, 0, 1));
+  if(n < 3){
+    return normals;
+  }
+  k = (std::min)(k, (uint32_t)n);
+
+  search_map map(points);
+  Tree tree(boost::counting_iterator<std::size_t>(0),
+    boost::counting_iterator<std::size_t>(n), 
+    Tree::Splitter(), Traits(map));
+  tree.build();
+  K_neighbor_search::Distance tr_dist(map);
+
+  parallelFor(n, [&](std::size_t i){
+    K_neighbor_search search(tree, points[i], k, 0, true, tr_dist);
+    double c[3] = {0, 0, 0};
+    std::size_t m = 0;
+    for(const auto& nb : search){
+      const Point& p = points[nb.first];
+      c[0] += p.x(); c[1] += p.y(); c[2] += p.z();
+      m++;
+    }
+    c[0] /= m; c[1] /= m; c[2] /= m;
+
+    std::array<double, 6> cov = {0, 0, 0, 0, 0, 0};
+    for(const auto& nb : search){
+      const Point& p = points[nb.first];
+      double d[3] = {p.x() - c[0], p.y() - c[1], p.z() - c[2]};
+      cov[0] += d[0] * d[0]; cov[1] += d[0] * d[1]; cov[2] += d[0] * d[2];
+      cov[3] += d[1] * d[1]; cov[4] += d[1] * d[2]; cov[5] += d[2] * d[2];
+    }
+
+    std::array<double, 3> eigenvalues;
+    std::array<double, 9> eigenvectors;
+    if(CGAL::Default_diagonalize_traits<double, 3>::
+        diagonalize_selfadjoint_covariance_matrix(cov, eigenvalues, eigenvectors)){
+      Gt::Vector_3 v(eigenvectors[0], eigenvectors[1], eigenvectors[2]);
+      double l = std::sqrt(v.squared_length());
+      if(l > 0){
+        normals[i] = v / l;
+      }
+    }
+  });
+
+  if(orient){
+    std::vector<Point_with_normal> pwn(n);
+    for(std::size_t i = 0; i < n; i++){
+      pwn[i] = Point_with_normal(points[i], normals[i], i);
+    }
+    CGAL::mst_orient_normals(pwn, k, CGAL::parameters::
+      point_map(CGAL::Nth_of_tuple_property_map<0, Point_with_normal>()).
+      normal_map(CGAL::Nth_of_tuple_property_map<1, Point_with_normal>()));
+    for(const Point_with_normal& p : pwn){
+      normals[std::get<2>(p)] = std::get<1>(p);
+    }
+  }
+  return normals;
+}
+
+// getRenderBuffers() function
+// Boundary mesh without isolated vertices, vertices are renumbered and 
+// mapped back to input points with pointIndices.
+// --------------------
+RenderBuffers AlphaShape3D::getRenderBuffers(void) {
+#ifdef DEBUG_ALPHA_SHAPE_3D
+  consoleLog(0, "Called getRenderBuffers()");
+#endif
+
+  RenderBuffers buffers;
+  Mesh surface_mesh_s(this->surface_mesh);
+  Mesh::Property_map<Mesh::Vertex_index, uint32_t> point_index = 
+    surface_mesh_s.add_property_map<Mesh::Vertex_index, uint32_t>("v:point_index", 0).first;
+  for(Mesh::Vertex_index v : surface_mesh_s.vertices()){
+    point_index[v] = v.idx();
+  }
+  PMP::remove_isolated_vertices(surface_mesh_s);
+  surface_mesh_s.collect_garbage();
+
+  Mesh::Property_map<Mesh::Vertex_index, Gt::Vector_3> vnormals = 
+    surface_mesh_s.add_property_map<Mesh::Vertex_index, Gt::Vector_3>(
+      "v:normal", CGAL::NULL_VECTOR).first;
+  PMP::compute_vertex_normals(surface_mesh_s, vnormals);
+
+  std::size_t nv = surface_mesh_s.number_of_vertices();
+  buffers.positions.resize(3 * nv);
+  buffers.normals.resize(3 * nv);
+  buffers.pointIndices.resize(nv);
+  for(Mesh::Vertex_index v : surface_mesh_s.vertices()){
+    const Point& p = surface_mesh_s.point(v);
+    const Gt::Vector_3& n = vnormals[v];
+    std::size_t i = v.idx();
+    for(uint8_t j = 0; j < 3; j++){
+      buffers.positions[3*i+j] = (float)p[j];
+      buffers.normals[3*i+j] = (float)n[j];
+    }
+    buffers.pointIndices[i] = point_index[v];
+  }
+
+  buffers.indices.reserve(3 * surface_mesh_s.number_of_faces());
+  for(Mesh::Face_index f : surface_mesh_s.faces()){
+    for(Mesh::Vertex_index v : vertices_around_face(surface_mesh_s.halfedge(f), surface_mesh_s)){
+      buffers.indices.push_back(v.idx());
+    }
+  }
+  return buffers;
+}
+
 // writeOff() function
 // --------------------
 void AlphaShape3D::writeOff(std::string filename, Matrix Points, Matrix bf) {
@@ -25,6 +25,14 @@
 #include <cassert>
 #include <list>
 #include <vector>
+#include <deque>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <array>
+#include <tuple>
+#include <algorithm>
 
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
@@ -43,16 +51,30 @@
 #include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
 #include <CGAL/Polygon_mesh_processing/measure.h>
 #include <CGAL/Polygon_mesh_processing/repair.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+
+#include <CGAL/AABB_halfedge_graph_segment_primitive.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/Polygon_mesh_slicer.h>
+#include <CGAL/intersections.h>
 
 #include <CGAL/Search_traits_3.h>
 #include <CGAL/Search_traits_adapter.h>
 #include <CGAL/Orthogonal_k_neighbor_search.h>
 #include <CGAL/boost/iterator/counting_iterator.hpp>
 
+#include <CGAL/Default_diagonalize_traits.h>
+#include <CGAL/mst_orient_normals.h>
+#include <CGAL/property_map.h>
+
+#include "native-utils.h"
+
 namespace alpha_shape_3d_ns {
 
 using namespace std;
 using namespace std::chrono;
+using namespace native_utils_ns;
 
 namespace SMS = CGAL::Surface_mesh_simplification;
 namespace PMP = CGAL::Polygon_mesh_processing;
@@ -83,11 +105,33 @@ typedef CGAL::Alpha_shape_3<Dt> As3;
 typedef CGAL::Surface_mesh<Point> Mesh;
 typedef std::vector<std::size_t> CGAL_Polygon;
 
+typedef boost::property_map<Mesh, CGAL::vertex_point_t>::type Mesh_vpm;
+typedef CGAL::AABB_halfedge_graph_segment_primitive<Mesh, Mesh_vpm> HGSP;
+typedef CGAL::AABB_traits_3<Gt, HGSP> AABB_traits;
+typedef CGAL::AABB_tree<AABB_traits> AABB_tree;
+typedef CGAL::Polygon_mesh_slicer<Mesh, Gt, Mesh_vpm, AABB_tree> Slicer;
+typedef std::vector<Point> Polyline;
+
+struct SliceResult {
+  std::vector<Polyline> polylines;
+  std::vector<double> areas;
+  double area;
+};
+
+struct RenderBuffers {
+  std::vector<float> positions;
+  std::vector<float> normals;
+  std::vector<uint32_t> indices;
+  std::vector<uint32_t> pointIndices;
+};
+
 typedef CGAL::Search_traits_3<Gt> Trb;
 typedef CGAL::Search_traits_adapter<std::size_t, search_map, Trb> Traits;
 typedef CGAL::Orthogonal_k_neighbor_search<Traits>  K_neighbor_search;
 typedef K_neighbor_search::Tree Tree;
 
+typedef std::tuple<Point, Gt::Vector_3, std::size_t> Point_with_normal;
+
 template <typename T>
 class CustomMatrix {
   private:
@@ -138,6 +182,10 @@ class AlphaShape3D : public Napi::ObjectWrap<AlphaShape3D> {
   Matrix getBoundaryFacets(std::string);
   void writeBoundaryFacets(std::string);
   Matrix checkInShape(Matrix);
+  void checkInShape(const double*, uint32_t, uint8_t*);
+  uint8_t classifyPoint(double, double, double);
+  void buildOccupancyGrid(uint32_t);
+  void clearOccupancyGrid(void);
   Matrix getTriangulation(void);
   std::pair<Matrix, Matrix> getNearestNeighbor(Matrix);
   std::pair<Matrix, Matrix> getSimplifiedShape(double);
@@ -145,7 +193,10 @@ class AlphaShape3D : public Napi::ObjectWrap<AlphaShape3D> {
   std::pair<Matrix, Matrix> getSimplifiedShape(std::string);
   std::pair<Matrix, Matrix> getSimplifiedShape(double, std::string);
   std::pair<Matrix, Matrix> removeUnusedPoints(Matrix, Matrix);
-  void writeOff(std::string, Matrix, Matrix);
+  static void writeOff(std::string, Matrix, Matrix);
+  std::vector<SliceResult> slice(const std::vector<Gt::Plane_3>&);
+  static std::vector<Gt::Vector_3> estimateNormals(const std::vector<Point>&, uint32_t, bool);
+  RenderBuffers getRenderBuffers(void);
 
   // New JavaScript wrapper methods
   void NewShapeJS(const Napi::CallbackInfo& info);
@@ -159,11 +210,16 @@ class AlphaShape3D : public Napi::ObjectWrap<AlphaShape3D> {
   Napi::Value GetBoundaryFacetsJS(const Napi::CallbackInfo& info);
   void WriteBoundaryFacetsJS(const Napi::CallbackInfo& info);
   Napi::Value CheckInShapeJS(const Napi::CallbackInfo& info);
-  void WriteOffJS(const Napi::CallbackInfo& info);
+  static void WriteOffJS(const Napi::CallbackInfo& info);
   Napi::Value GetTriangulationJS(const Napi::CallbackInfo& info);
   Napi::Value GetNearestNeighborJS(const Napi::CallbackInfo& info);
   Napi::Value GetSimplifiedShapeJS(const Napi::CallbackInfo& info);
   Napi::Value RemoveUnusedPointsJS(const Napi::CallbackInfo& info);
+  Napi::Value SliceJS(const Napi::CallbackInfo& info);
+  Napi::Value BuildOccupancyGridJS(const Napi::CallbackInfo& info);
+  void ClearOccupancyGridJS(const Napi::CallbackInfo& info);
+  static Napi::Value EstimateNormalsJS(const Napi::CallbackInfo& info);
+  Napi::Value GetRenderBuffersJS(const Napi::CallbackInfo& info);
     
 private:
   As3 *alphaShape;
@@ -171,6 +227,13 @@ private:
   Matrix triangulationMatrix;
   std::size_t numAlphaValues;
   Mesh surface_mesh;
+  bool alphaSet;
+
+  // Occupancy grid labels: 0 - outside, 1 - inside, 2 - boundary
+  std::vector<uint8_t> occupancyGrid;
+  double gridOrigin[3];
+  double gridCellSize;
+  uint32_t gridDims[3];
 };
 
 }// namespace alpha_shape_3d_ns
@@ -0,0 +1,631 @@
+// JSLAB - native-module-control.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// c2dKernel() function
+// Discretization of state-space model (A, B, C, D) with n states, m inputs
+// and p outputs, method is 'zoh', 'foh' or 'tustin'
+// --------------------
+bool c2dKernel(const MatrixXd& A, const MatrixXd& B, const MatrixXd& C, 
+    const MatrixXd& D, double Ts, const std::string& method, 
+    MatrixXd& Ad, MatrixXd& Bd, MatrixXd& Cd, MatrixXd& Dd) {
+  Index n = A.rows(), m = B.cols();
+  if(method == "zoh") {
+    MatrixXd M = MatrixXd::Zero(n + m, n + m);
+    M.topLeftCorner(n, n) = A * Ts;
+    M.topRightCorner(n, m) = B * Ts;
+    MatrixXd E = M.exp();
+    Ad = E.topLeftCorner(n, n);
+    Bd = E.topRightCorner(n, m);
+    Cd = C;
+    Dd = D;
+  } else if(method == "foh") {
+    // Triangle hold, states are shifted by Gamma2*u
+    MatrixXd M = MatrixXd::Zero(n + 2 * m, n + 2 * m);
+    M.topLeftCorner(n, n) = A * Ts;
+    M.block(0, n, n, m) = B * Ts;
+    M.block(n, n + m, m, m) = MatrixXd::Identity(m, m);
+    MatrixXd E = M.exp();
+    Ad = E.topLeftCorner(n, n);
+    MatrixXd G1 = E.block(0, n, n, m);
+    MatrixXd G2 = E.block(0, n + m, n, m);
+    Bd = G1 + Ad * G2 - G2;
+    Cd = C;
+    Dd = D + C * G2;
+  } else if(method == "tustin") {
+    MatrixXd I = MatrixXd::Identity(n, n);
+    MatrixXd W = PartialPivLU<MatrixXd>(I - A * (Ts / 2)).inverse();
+    Ad = W * (I + A * (Ts / 2));
+    Bd = W * B * Ts;
+    Cd = C * W;
+    Dd = D + Cd * B * (Ts / 2);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+// c2d() function
+// Arguments are (A, B, C, D, n, m, p, Ts, method) with column-major 
+// matrices, returns discrete matrices A, B, C and D
+// --------------------
+Napi::Value NativeModule::c2d(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[3];
+  if(!readDimensions(info, 4, 3, "State-space dimensions", dims)) {
+    return env.Null();
+  }
+  size_t n = dims[0], m = dims[1], p = dims[2];
+  std::vector<double> a_buffer, b_buffer, c_buffer, d_buffer;
+  const double* a = nullptr;
+  const double* b = nullptr;
+  const double* c = nullptr;
+  const double* d = nullptr;
+  if(!readMatrix(env, info[0], "A", n, n, a_buffer, a) ||
+      !readMatrix(env, info[1], "B", n, m, b_buffer, b) ||
+      !readMatrix(env, info[2], "C", p, n, c_buffer, c) ||
+      !readMatrix(env, info[3], "D", p, m, d_buffer, d)) {
+    return env.Null();
+  }
+  if(info.Length() < 8 || !info[7].IsNumber() || 
+      !(info[7].As<Napi::Number>().DoubleValue() > 0)) {
+    Napi::RangeError::New(env, "Sampling time must be positive").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double Ts = info[7].As<Napi::Number>().DoubleValue();
+  std::string method = info.Length() > 8 && info[8].IsString() ? 
+    info[8].As<Napi::String>().Utf8Value() : "zoh";
+
+  MatrixXd Ad, Bd, Cd, Dd;
+  if(!c2dKernel(Map<const MatrixXd>(a, n, n), Map<const MatrixXd>(b, n, m),
+      Map<const MatrixXd>(c, p, n), Map<const MatrixXd>(d, p, m), Ts, method,
+      Ad, Bd, Cd, Dd)) {
+    Napi::TypeError::New(env, "Method must be 'zoh', 'foh' or 'tustin'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  const MatrixXd* result[4] = {&Ad, &Bd, &Cd, &Dd};
+  const char* names[4] = {"A", "B", "C", "D"};
+  for(int k = 0; k < 4; ++k) {
+    Napi::Float64Array array = Napi::Float64Array::New(env, result[k]->size());
+    std::copy(result[k]->data(), result[k]->data() + result[k]->size(), array.Data());
+    jsResult.Set(names[k], array);
+  }
+  return jsResult;
+}
+
+// lsimKernel() function
+// Direct form II transposed simulation of transfer function num/den, 
+// shorter numerator is aligned to the denominator as in z^-1 polynomials
+// --------------------
+bool lsimKernel(const double* num, size_t nb, const double* den, size_t na, 
+    const double* u, size_t N, double* y) {
+  if(na == 0 || den[0] == 0) {
+    return false;
+  }
+  size_t order = (std::max)(nb, na) - 1;
+  std::vector<double> b(order + 1, 0.0), a(order + 1, 0.0), z(order + 1, 0.0);
+  size_t shift = nb < na ? na - nb : 0;
+  for(size_t i = 0; i < nb; ++i) {
+    b[shift + i] = num[i] / den[0];
+  }
+  for(size_t i = 0; i < na; ++i) {
+    a[i] = den[i] / den[0];
+  }
+
+  for(size_t k = 0; k < N; ++k) {
+    double uk = u[k];
+    double yk = b[0] * uk + z[0];
+    for(size_t i = 1; i < order; ++i) {
+      z[i - 1] = b[i] * uk + z[i] - a[i] * yk;
+    }
+    if(order > 0) {
+      z[order - 1] = b[order] * uk - a[order] * yk;
+    }
+    y[k] = yk;
+  }
+  return true;
+}
+
+// lsim() function
+// Arguments are (num, den, u), returns output of discrete transfer function
+// --------------------
+Napi::Value NativeModule::lsim(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> num_buffer, den_buffer, u_buffer;
+  const double* num = nullptr;
+  const double* den = nullptr;
+  const double* u = nullptr;
+  size_t nb, na, N;
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "lsim expects num, den and u").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readNumbers(env, info[0], "Numerator", num_buffer, num, nb) ||
+      !readNumbers(env, info[1], "Denominator", den_buffer, den, na) ||
+      !readNumbers(env, info[2], "Input", u_buffer, u, N)) {
+    return env.Null();
+  }
+
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, N);
+  if(!lsimKernel(num, nb, den, na, u, N, jsResult.Data())) {
+    Napi::RangeError::New(env, "Leading denominator coefficient must be nonzero").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  return jsResult;
+}
+
+// lsimBatch() function
+// Arguments are (nums, dens, u, count) with coefficients of count systems 
+// stored one after another, returns count x N outputs stored by system
+// --------------------
+Napi::Value NativeModule::lsimBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> num_buffer, den_buffer, u_buffer;
+  const double* nums = nullptr;
+  const double* dens = nullptr;
+  const double* u = nullptr;
+  size_t nb, na, N, count;
+  if(info.Length() < 4) {
+    Napi::TypeError::New(env, "lsimBatch expects nums, dens, u and count").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readNumbers(env, info[0], "Numerators", num_buffer, nums, nb) ||
+      !readNumbers(env, info[1], "Denominators", den_buffer, dens, na) ||
+      !readNumbers(env, info[2], "Input", u_buffer, u, N) ||
+      !readDimensions(info, 3, 1, "Number of systems", &count)) {
+    return env.Null();
+  }
+  if(count == 0 || nb % count != 0 || na % count != 0) {
+    Napi::RangeError::New(env, "Coefficient arrays must hold the same number of coefficients for each system").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  nb /= count;
+  na /= count;
+
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, count * N);
+  double* y = jsResult.Data();
+  std::atomic<bool> valid(true);
+  parallelFor(count, [&](size_t k) {
+    if(!lsimKernel(nums + k * nb, nb, dens + k * na, na, u, N, y + k * N)) {
+      valid = false;
+    }
+  });
+  if(!valid) {
+    Napi::RangeError::New(env, "Leading denominator coefficient must be nonzero").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  return jsResult;
+}
+
+// lsimSS() function
+// Arguments are (A, B, C, D, n, m, p, u, x0) with column-major matrices 
+// and inputs stored by sample (m x N), returns outputs stored by sample (p x N)
+// --------------------
+Napi::Value NativeModule::lsimSS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[3];
+  if(!readDimensions(info, 4, 3, "State-space dimensions", dims)) {
+    return env.Null();
+  }
+  size_t n = dims[0], m = dims[1], p = dims[2];
+  std::vector<double> a_buffer, b_buffer, c_buffer, d_buffer, u_buffer, x_buffer;
+  const double* a = nullptr;
+  const double* b = nullptr;
+  const double* c = nullptr;
+  const double* d = nullptr;
+  const double* u = nullptr;
+  const double* x0 = nullptr;
+  size_t nu, nx;
+  if(info.Length() < 8) {
+    Napi::TypeError::New(env, "lsimSS expects A, B, C, D, n, m, p and u").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readMatrix(env, info[0], "A", n, n, a_buffer, a) ||
+      !readMatrix(env, info[1], "B", n, m, b_buffer, b) ||
+      !readMatrix(env, info[2], "C", p, n, c_buffer, c) ||
+      !readMatrix(env, info[3], "D", p, m, d_buffer, d) ||
+      !readNumbers(env, info[7], "Input", u_buffer, u, nu)) {
+    return env.Null();
+  }
+  if(m == 0 || nu % m != 0) {
+    Napi::RangeError::New(env, "Input length must be a multiple of number of inputs").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t N = nu / m;
+  VectorXd x = VectorXd::Zero(n);
+  if(info.Length() > 8 && !info[8].IsUndefined()) {
+    if(!readNumbers(env, info[8], "Initial state", x_buffer, x0, nx)) {
+      return env.Null();
+    }
+    if(nx != n) {
+      Napi::RangeError::New(env, "Initial state length must match number of states").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    x = Map<const VectorXd>(x0, n);
+  }
+
+  Map<const MatrixXd> A(a, n, n), B(b, n, m), C(c, p, n), D(d, p, m);
+  Map<const MatrixXd> U(u, m, N);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, p * N);
+  Map<MatrixXd> Y(jsResult.Data(), p, N);
+  VectorXd xn(n);
+  for(size_t k = 0; k < N; ++k) {
+    Y.col(k).noalias() = C * x + D * U.col(k);
+    xn.noalias() = A * x + B * U.col(k);
+    x.swap(xn);
+  }
+  return jsResult;
+}
+
+// tfToSS() function
+// Controllable canonical form of transfer function with den[0] = 1, 
+// same realization as control.tf2ss
+// --------------------
+void tfToSS(const VectorXd& num, const VectorXd& den, 
+    MatrixXd& A, MatrixXd& B, MatrixXd& C, MatrixXd& D) {
+  Index n = den.size() - 1;
+  VectorXd b = VectorXd::Zero(n + 1);
+  b.tail(num.size()) = num;
+  A = MatrixXd::Zero(n, n);
+  B = MatrixXd::Zero(n, 1);
+  C = MatrixXd::Zero(1, n);
+  D = MatrixXd::Constant(1, 1, b(0));
+  for(Index i = 0; i + 1 < n; ++i) {
+    A(i, i + 1) = 1;
+  }
+  for(Index j = 0; j < n; ++j) {
+    A(n - 1, j) = -den(n - j);
+    C(0, j) = b(n - j) - den(n - j) * b(0);
+  }
+  if(n > 0) {
+    B(n - 1, 0) = 1;
+  }
+}
+
+// TfestProblem struct
+// Continuous transfer function with np poles and nz zeros fitted to 
+// sampled input and output, parameters are [den(2:end), num]
+// --------------------
+struct TfestProblem {
+  const double* u;
+  const double* y;
+  size_t N;
+  double Ts;
+  size_t np;
+  size_t nz;
+
+  // Simulates model with parameters x, returns false for unstable output
+  bool simulate(const VectorXd& x, double* yhat) const {
+    VectorXd den(np + 1);
+    den(0) = 1;
+    den.tail(np) = x.head(np);
+    MatrixXd A, B, C, D, Ad, Bd, Cd, Dd;
+    tfToSS(x.tail(nz + 1), den, A, B, C, D);
+    c2dKernel(A, B, C, D, Ts, "zoh", Ad, Bd, Cd, Dd);
+    if(!Ad.allFinite() || !Bd.allFinite()) {
+      return false;
+    }
+    VectorXd s = VectorXd::Zero(np), sn(np);
+    for(size_t k = 0; k < N; ++k) {
+      yhat[k] = Cd.row(0).dot(s) + Dd(0, 0) * u[k];
+      sn.noalias() = Ad * s + Bd.col(0) * u[k];
+      s.swap(sn);
+    }
+    return Map<const VectorXd>(yhat, N).allFinite();
+  }
+
+  // Mean squared error of model with parameters x
+  double cost(const VectorXd& x, VectorXd& yhat) const {
+    yhat.resize(N);
+    if(!simulate(x, yhat.data())) {
+      return std::numeric_limits<double>::infinity();
+    }
+    return (yhat - Map<const VectorXd>(y, N)).squaredNorm() / N;
+  }
+};
+
+// tfestInitialize() function
+// ARX least squares fit of discrete model, converted to continuous time 
+// by inverting zero-order hold with matrix logarithm
+// --------------------
+VectorXd tfestInitialize(const TfestProblem& P) {
+  size_t np = P.np, nz = P.nz;
+  VectorXd x0 = VectorXd::Zero(np + nz + 1);
+  bool proper = nz >= np;
+  size_t nb = proper ? np + 1 : np;
+  if(P.N <= np || P.N - np < np + nb) {
+    return x0;
+  }
+
+  size_t rows = P.N - np;
+  MatrixXd Phi(rows, np + nb);
+  VectorXd Y(rows);
+  for(size_t r = 0; r < rows; ++r) {
+    size_t k = r + np;
+    for(size_t i = 0; i < np; ++i) {
+      Phi(r, i) = -P.y[k - 1 - i];
+    }
+    for(size_t j = 0; j < nb; ++j) {
+      Phi(r, np + j) = P.u[k - j - (proper ? 0 : 1)];
+    }
+    Y(r) = P.y[k];
+  }
+  VectorXd theta = Phi.colPivHouseholderQr().solve(Y);
+
+  VectorXd dend(np + 1), numd = VectorXd::Zero(np + 1);
+  dend(0) = 1;
+  dend.tail(np) = theta.head(np);
+  numd.tail(nb) = theta.tail(nb);
+
+  MatrixXd Ad, Bd, Cd, Dd;
+  tfToSS(numd, dend, Ad, Bd, Cd, Dd);
+  MatrixXd M = MatrixXd::Identity(np + 1, np + 1);
+  M.topLeftCorner(np, np) = Ad;
+  M.topRightCorner(np, 1) = Bd;
+  MatrixXd L = M.log();
+  // Poles on negative real axis have no real continuous counterpart
+  if(!L.allFinite() || !L.exp().isApprox(M, 1e-6)) {
+    return x0;
+  }
+  L /= P.Ts;
+  MatrixXd A = L.topLeftCorner(np, np);
+  MatrixXd B = L.topRightCorner(np, 1);
+  VectorXd den = charpolyKernel(A);
+  VectorXd num = charpolyKernel(A - B * Cd) + (Dd(0, 0) - 1) * den;
+  x0.head(np) = den.tail(np);
+  x0.tail((std::min)(nz + 1, np + 1)) = num.tail((std::min)(nz + 1, np + 1));
+  return x0.allFinite() ? x0 : VectorXd::Zero(np + nz + 1);
+}
+
+// tfestLM() function
+// Levenberg-Marquardt refinement with forward difference Jacobian
+// --------------------
+int tfestLM(const TfestProblem& P, VectorXd& x, double& cost, 
+    int max_iterations, double tol) {
+  Index p = x.size();
+  Map<const VectorXd> y(P.y, P.N);
+  VectorXd yhat, yn;
+  cost = P.cost(x, yhat);
+  if(!std::isfinite(cost)) {
+    return 0;
+  }
+  double lambda = 1e-3;
+  MatrixXd J(P.N, p);
+  int iter = 0;
+  while(iter < max_iterations) {
+    iter++;
+    parallelFor(p, [&](size_t j) {
+      VectorXd xj = x;
+      double h = 1e-6 * (std::max)(std::abs(x(j)), 1.0);
+      xj(j) += h;
+      if(P.simulate(xj, J.col(j).data())) {
+        J.col(j) = (J.col(j) - yhat) / h;
+      } else {
+        J.col(j).setZero();
+      }
+    });
+    VectorXd r = yhat - y;
+    VectorXd g = J.transpose() * r;
+    MatrixXd H = J.transpose() * J;
+    VectorXd Hd = H.diagonal().cwiseMax(1e-12);
+
+    bool accepted = false;
+    VectorXd delta;
+    double cost_new = cost;
+    for(int trial = 0; trial < 16; ++trial) {
+      MatrixXd Hl = H;
+      Hl.diagonal() += lambda * Hd;
+      delta = Hl.ldlt().solve(-g);
+      VectorXd xn = x + delta;
+      cost_new = P.cost(xn, yn);
+      if(cost_new < cost) {
+        x = xn;
+        yhat.swap(yn);
+        lambda = (std::max)(lambda / 3, 1e-12);
+        accepted = true;
+        break;
+      }
+      lambda *= 4;
+    }
+    if(!accepted) {
+      break;
+    }
+    double decrease = cost - cost_new;
+    cost = cost_new;
+    if(decrease <= tol * cost || delta.norm() <= tol * (x.norm() + tol)) {
+      break;
+    }
+  }
+  return iter;
+}
+
+// tfestNelderMead() function
+// Derivative-free refinement with adaptive simplex
+// --------------------
+int tfestNelderMead(const TfestProblem& P, VectorXd& x, double& cost, 
+    int max_iterations, double tol) {
+  Index p = x.size();
+  VectorXd yhat;
+  std::vector<VectorXd> S(p + 1, x);
+  std::vector<double> f(p + 1);
+  for(Index i = 0; i < p; ++i) {
+    S[i + 1](i) += x(i) != 0 ? 0.05 * x(i) : 0.00025;
+  }
+  for(Index i = 0; i <= p; ++i) {
+    f[i] = P.cost(S[i], yhat);
+  }
+
+  std::vector<Index> order(p + 1);
+  int iter = 0;
+  while(iter < max_iterations) {
+    for(Index i = 0; i <= p; ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](Index a, Index b) {
+      return f[a] < f[b];
+    });
+    Index best = order[0], worst = order[p], second = order[p - 1];
+    double spread = 0;
+    for(Index i = 1; i <= p; ++i) {
+      spread = (std::max)(spread, (S[order[i]] - S[best]).cwiseAbs().maxCoeff());
+    }
+    if(std::isfinite(f[worst]) && f[worst] - f[best] <= tol * (1 + std::abs(f[best])) && 
+        spread <= tol * (1 + S[best].cwiseAbs().maxCoeff())) {
+      break;
+    }
+    iter++;
+
+    VectorXd centroid = VectorXd::Zero(p);
+    for(Index i = 0; i < p; ++i) {
+      centroid += S[order[i]];
+    }
+    centroid /= (double)p;
+
+    VectorXd xr = centroid + (centroid - S[worst]);
+    double fr = P.cost(xr, yhat);
+    if(fr < f[best]) {
+      VectorXd xe = centroid + 2 * (centroid - S[worst]);
+      double fe = P.cost(xe, yhat);
+      if(fe < fr) {
+        S[worst] = xe; f[worst] = fe;
+      } else {
+        S[worst] = xr; f[worst] = fr;
+      }
+    } else if(fr < f[second]) {
+      S[worst] = xr; f[worst] = fr;
+    } else {
+      bool outside = fr < f[worst];
+      VectorXd xc = outside ? VectorXd(centroid + 0.5 * (xr - centroid)) : 
+        VectorXd(centroid + 0.5 * (S[worst] - centroid));
+      double fc = P.cost(xc, yhat);
+      if(fc < (outside ? fr : f[worst])) {
+        S[worst] = xc; f[worst] = fc;
+      } else {
+        for(Index i = 1; i <= p; ++i) {
+          Index k = order[i];
+          S[k] = S[best] + 0.5 * (S[k] - S[best]);
+          f[k] = P.cost(S[k], yhat);
+        }
+      }
+    }
+  }
+
+  Index best = std::min_element(f.begin(), f.end()) - f.begin();
+  x = S[best];
+  cost = f[best];
+  return iter;
+}
+
+// tfest() function
+// Arguments are (u, y, Ts, np, nz, method, options) with method 'lm' or 
+// 'neldermead' and options {maxIterations, tol}, returns continuous 
+// transfer function coefficients and fit metrics
+// --------------------
+Napi::Value NativeModule::tfest(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 5) {
+    Napi::TypeError::New(env, "tfest expects u, y, Ts, np and nz").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> u_buffer, y_buffer;
+  const double* u = nullptr;
+  const double* y = nullptr;
+  size_t nu, N;
+  if(!readNumbers(env, info[0], "Input", u_buffer, u, nu) ||
+      !readNumbers(env, info[1], "Output", y_buffer, y, N)) {
+    return env.Null();
+  }
+  if(nu != N || N == 0) {
+    Napi::RangeError::New(env, "Input and output must have the same nonzero length").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!info[2].IsNumber() || !(info[2].As<Napi::Number>().DoubleValue() > 0)) {
+    Napi::RangeError::New(env, "Sampling time must be positive").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t orders[2];
+  if(!readDimensions(info, 3, 2, "Model orders", orders)) {
+    return env.Null();
+  }
+  if(orders[1] > orders[0]) {
+    Napi::RangeError::New(env, "Number of zeros must not exceed number of poles").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::string method = info.Length() > 5 && info[5].IsString() ? 
+    info[5].As<Napi::String>().Utf8Value() : "lm";
+  if(method != "lm" && method != "neldermead") {
+    Napi::TypeError::New(env, "Method must be 'lm' or 'neldermead'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  TfestProblem P = {u, y, N, info[2].As<Napi::Number>().DoubleValue(), 
+    orders[0], orders[1]};
+  size_t p = P.np + P.nz + 1;
+  int max_iterations = method == "lm" ? 100 : (int)(200 * p);
+  double tol = method == "lm" ? 1e-10 : 1e-8;
+  if(info.Length() > 6 && info[6].IsObject()) {
+    Napi::Object options = info[6].As<Napi::Object>();
+    if(options.Has("maxIterations") && options.Get("maxIterations").IsNumber()) {
+      max_iterations = options.Get("maxIterations").As<Napi::Number>().Int32Value();
+    }
+    if(options.Has("tol") && options.Get("tol").IsNumber()) {
+      tol = options.Get("tol").As<Napi::Number>().DoubleValue();
+    }
+  }
+
+  VectorXd x = tfestInitialize(P);
+  double cost;
+  int iterations = method == "lm" ? tfestLM(P, x, cost, max_iterations, tol) : 
+    tfestNelderMead(P, x, cost, max_iterations, tol);
+  if(method == "lm" && !std::isfinite(cost)) {
+    // Unstable initial model, restart from zero parameters
+    x.setZero();
+    iterations += tfestNelderMead(P, x, cost, 200 * (int)p, tol);
+  }
+
+  Map<const VectorXd> Y(y, N);
+  VectorXd yhat;
+  cost = P.cost(x, yhat);
+  // Normalized root mean squared error fit, undefined for constant output
+  // unless it is matched exactly
+  double res_norm = (Y - yhat).norm();
+  double ref_norm = (Y.array() - Y.mean()).matrix().norm();
+  double fit;
+  if(ref_norm > 0) {
+    fit = 100 * (1 - res_norm / ref_norm);
+  } else {
+    fit = res_norm <= 1e-12 * Y.norm() ? 100 : 
+      std::numeric_limits<double>::quiet_NaN();
+  }
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  Napi::Float64Array num = Napi::Float64Array::New(env, P.nz + 1);
+  Napi::Float64Array den = Napi::Float64Array::New(env, P.np + 1);
+  den[(size_t)0] = 1;
+  for(size_t i = 0; i < P.np; ++i) {
+    den[i + 1] = x(i);
+  }
+  for(size_t i = 0; i <= P.nz; ++i) {
+    num[i] = x(P.np + i);
+  }
+  jsResult.Set("num", num);
+  jsResult.Set("den", den);
+  jsResult.Set("mse", cost);
+  jsResult.Set("fit", fit);
+  jsResult.Set("iterations", iterations);
+  return jsResult;
+}
+
+}  // namespace native_module_ns
@@ -0,0 +1,581 @@
+// JSLAB - native-module-fft.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+typedef std::complex<double> cd;
+
+const double FFT_PI = 3.14159265358979323846;
+
+// Sizes from which transforms are split over threads
+const size_t FFT_PARALLEL_SIZE = 1 << 16;
+
+// Largest prime factor handled by mixed radix butterflies
+const size_t FFT_MAX_RADIX = 13;
+
+// Maximal number of cached plans
+const size_t FFT_PLAN_CACHE_SIZE = 64;
+
+// fftPlan() function
+// Returns cached plan with factors and twiddles, sizes with large prime
+// factors are transformed with Bluestein algorithm over power of two
+// --------------------
+std::shared_ptr<const FFTPlan> fftPlan(size_t n) {
+  static std::mutex cache_mutex;
+  static std::map<size_t, std::shared_ptr<const FFTPlan>> cache;
+  {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(n);
+    if(it != cache.end()) {
+      return it->second;
+    }
+  }
+
+  auto plan = std::make_shared<FFTPlan>();
+  plan->n = n;
+  size_t r = n;
+  while(r % 4 == 0 && r > 4) {
+    plan->factors.push_back(4);
+    r /= 4;
+  }
+  for(size_t p = 2; p <= FFT_MAX_RADIX && r > 1; ) {
+    if(r % p == 0) {
+      plan->factors.push_back(p);
+      r /= p;
+    } else {
+      p += (p == 2) ? 1 : 2;
+    }
+  }
+  if(r > 1) {
+    // Bluestein algorithm, chirp angles are reduced modulo 2n for accuracy
+    plan->factors.clear();
+    size_t m = 1;
+    while(m < 2 * n - 1) {
+      m <<= 1;
+    }
+    plan->m = m;
+    plan->sub = fftPlan(m);
+    plan->chirp.resize(n);
+    for(size_t k = 0; k < n; ++k) {
+      unsigned long long k2 = ((unsigned long long)k * k) % (2 * n);
+      plan->chirp[k] = std::polar(1.0, -FFT_PI * (double)k2 / (double)n);
+    }
+    std::vector<cd> b(m, cd(0, 0));
+    b[0] = std::conj(plan->chirp[0]);
+    for(size_t k = 1; k < n; ++k) {
+      b[k] = b[m - k] = std::conj(plan->chirp[k]);
+    }
+    plan->filter.resize(m);
+    fftKernel(*plan->sub, b.data(), plan->filter.data(), false, false);
+    for(size_t k = 0; k < m; ++k) {
+      plan->filter[k] /= (double)m;
+    }
+  } else {
+    plan->twiddles.resize(n);
+    for(size_t k = 0; k < n; ++k) {
+      plan->twiddles[k] = std::polar(1.0, 
+        -2.0 * FFT_PI * (double)k / (double)n);
+    }
+  }
+
+  std::lock_guard<std::mutex> lock(cache_mutex);
+  if(cache.size() >= FFT_PLAN_CACHE_SIZE) {
+    cache.clear();
+  }
+  cache[n] = plan;
+  return plan;
+}
+
+// fftButterfly() function
+// Combines p transforms of length m stored one after another
+// --------------------
+void fftButterfly(const FFTPlan& plan, cd* out, size_t fstride, size_t m,
+    size_t p, bool inverse, size_t k0, size_t k1) {
+  const cd* tw = plan.twiddles.data();
+  auto twiddle = [&](size_t j) {
+    return inverse ? std::conj(tw[j]) : tw[j];
+  };
+  if(p == 2) {
+    for(size_t k = k0; k < k1; ++k) {
+      cd t = out[k + m] * twiddle(k * fstride);
+      out[k + m] = out[k] - t;
+      out[k] += t;
+    }
+  } else if(p == 4) {
+    for(size_t k = k0; k < k1; ++k) {
+      cd t0 = out[k];
+      cd t1 = out[k + m] * twiddle(k * fstride);
+      cd t2 = out[k + 2 * m] * twiddle(2 * k * fstride);
+      cd t3 = out[k + 3 * m] * twiddle(3 * k * fstride);
+      cd a = t0 + t2, b = t0 - t2, c = t1 + t3;
+      cd d = (t1 - t3) * (inverse ? cd(0, 1) : cd(0, -1));
+      out[k] = a + c;
+      out[k + m] = b + d;
+      out[k + 2 * m] = a - c;
+      out[k + 3 * m] = b - d;
+    }
+  } else {
+    cd t[FFT_MAX_RADIX];
+    size_t n = plan.n;
+    for(size_t k = k0; k < k1; ++k) {
+      for(size_t q = 0; q < p; ++q) {
+        t[q] = out[k + q * m] * twiddle((q * k * fstride) % n);
+      }
+      for(size_t s = 0; s < p; ++s) {
+        cd sum = t[0];
+        for(size_t q = 1; q < p; ++q) {
+          sum += t[q] * twiddle(((q * s) % p) * m * fstride);
+        }
+        out[k + s * m] = sum;
+      }
+    }
+  }
+}
+
+// fftWork() function
+// Recursive mixed radix decimation in time, sub-transforms and butterflies
+// of top level are split over threads for large sizes
+// --------------------
+void fftWork(const FFTPlan& plan, const cd* in, size_t istride, cd* out,
+    size_t n, size_t fstride, size_t level, bool inverse, bool parallel) {
+  size_t p = plan.factors[level], m = n / p;
+  if(m == 1) {
+    for(size_t q = 0; q < p; ++q) {
+      out[q] = in[q * istride];
+    }
+  } else {
+    auto sub = [&](size_t q) {
+      fftWork(plan, in + q * istride, istride * p, out + q * m, m,
+        fstride * p, level + 1, inverse, false);
+    };
+    if(parallel) {
+      parallelFor(p, sub);
+    } else {
+      for(size_t q = 0; q < p; ++q) {
+        sub(q);
+      }
+    }
+  }
+  if(parallel) {
+    const size_t block = 4096;
+    parallelFor((m + block - 1) / block, [&](size_t b) {
+      fftButterfly(plan, out, fstride, m, p, inverse, b * block,
+        (std::min)(m, (b + 1) * block));
+    });
+  } else {
+    fftButterfly(plan, out, fstride, m, p, inverse, 0, m);
+  }
+}
+
+// fftKernel() function
+// Unnormalized transform of n = plan.n complex values, in and out must not
+// overlap
+// --------------------
+void fftKernel(const FFTPlan& plan, const cd* in, cd* out, bool inverse,
+    bool parallel) {
+  size_t n = plan.n;
+  if(n == 0) {
+    return;
+  }
+  if(n == 1) {
+    out[0] = in[0];
+    return;
+  }
+  parallel = parallel && n >= FFT_PARALLEL_SIZE;
+  if(plan.m == 0) {
+    fftWork(plan, in, 1, out, n, 1, 0, inverse, parallel);
+    return;
+  }
+
+  // Bluestein, inverse transform as conjugate of forward transform
+  size_t m = plan.m;
+  std::vector<cd> a(m, cd(0, 0)), A(m);
+  for(size_t k = 0; k < n; ++k) {
+    a[k] = (inverse ? std::conj(in[k]) : in[k]) * plan.chirp[k];
+  }
+  fftKernel(*plan.sub, a.data(), A.data(), false, parallel);
+  for(size_t k = 0; k < m; ++k) {
+    A[k] *= plan.filter[k];
+  }
+  fftKernel(*plan.sub, A.data(), a.data(), true, parallel);
+  for(size_t k = 0; k < n; ++k) {
+    cd v = a[k] * plan.chirp[k];
+    out[k] = inverse ? std::conj(v) : v;
+  }
+}
+
+// rfftKernel() function
+// One-sided transform of n real values with n/2+1 outputs, even sizes are
+// packed into complex transform of half size
+// --------------------
+void rfftKernel(const double* x, size_t n, cd* out, bool parallel) {
+  if(n == 0) {
+    return;
+  }
+  if(n % 2 == 1) {
+    std::vector<cd> z(n), Z(n);
+    for(size_t k = 0; k < n; ++k) {
+      z[k] = cd(x[k], 0);
+    }
+    fftKernel(*fftPlan(n), z.data(), Z.data(), false, parallel);
+    std::copy(Z.begin(), Z.begin() + n / 2 + 1, out);
+    return;
+  }
+  size_t h = n / 2;
+  std::vector<cd> z(h), Z(h);
+  for(size_t k = 0; k < h; ++k) {
+    z[k] = cd(x[2 * k], x[2 * k + 1]);
+  }
+  fftKernel(*fftPlan(h), z.data(), Z.data(), false, parallel);
+  for(size_t k = 0; k <= h; ++k) {
+    cd zk = Z[k % h], zc = std::conj(Z[(h - k) % h]);
+    cd e = 0.5 * (zk + zc);
+    cd o = cd(0, -0.5) * (zk - zc);
+    out[k] = e + std::polar(1.0, -2.0 * FFT_PI * (double)k / (double)n) * o;
+  }
+}
+
+// irfftKernel() function
+// Real inverse transform of length n from nh nonnegative frequency terms of
+// Hermitian spectrum, scaled by 1/n
+// --------------------
+void irfftKernel(const cd* X, size_t nh, size_t n, double* out, 
+    bool parallel) {
+  if(n == 0) {
+    return;
+  }
+  std::vector<cd> Z(n, cd(0, 0)), z(n);
+  for(size_t k = 0; k <= n / 2 && k < nh; ++k) {
+    Z[k] = X[k];
+    if(k > 0 && k < n - k) {
+      Z[n - k] = std::conj(X[k]);
+    }
+  }
+  fftKernel(*fftPlan(n), Z.data(), z.data(), true, parallel);
+  for(size_t k = 0; k < n; ++k) {
+    out[k] = z[k].real() / (double)n;
+  }
+}
+
+// readComplex() function
+// Reads real and optional imaginary parts, zero padded or truncated to n 
+// when n is nonzero
+// --------------------
+bool readComplex(const Napi::CallbackInfo& info, size_t first, size_t& n,
+    std::vector<cd>& data) {
+  Napi::Env env = info.Env();
+  std::vector<double> re_buffer, im_buffer;
+  const double* re = nullptr;
+  const double* im = nullptr;
+  size_t nr, ni = 0;
+  if(!readNumbers(env, info[first], "Real part", re_buffer, re, nr)) {
+    return false;
+  }
+  if(info.Length() > first + 1 && !info[first + 1].IsUndefined() &&
+      !info[first + 1].IsNull()) {
+    if(!readNumbers(env, info[first + 1], "Imaginary part", im_buffer, im, ni)) {
+      return false;
+    }
+    if(ni != nr) {
+      Napi::RangeError::New(env, "Real and imaginary parts must have the same length").ThrowAsJavaScriptException();
+      return false;
+    }
+  }
+  if(n == 0) {
+    n = nr;
+  }
+  data.assign(n, cd(0, 0));
+  for(size_t k = 0; k < (std::min)(nr, data.size()); ++k) {
+    data[k] = cd(re[k], im ? im[k] : 0.0);
+  }
+  return true;
+}
+
+// complexResult() function
+// --------------------
+Napi::Object complexResult(Napi::Env env, const cd* data, size_t n) {
+  Napi::Float64Array jsRe = Napi::Float64Array::New(env, n);
+  Napi::Float64Array jsIm = Napi::Float64Array::New(env, n);
+  double* re = jsRe.Data();
+  double* im = jsIm.Data();
+  for(size_t k = 0; k < n; ++k) {
+    re[k] = data[k].real();
+    im[k] = data[k].imag();
+  }
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("re", jsRe);
+  result.Set("im", jsIm);
+  return result;
+}
+
+// readTransformLength() function
+// Optional transform length, 0 keeps input length
+// --------------------
+bool readTransformLength(const Napi::CallbackInfo& info, size_t index,
+    size_t& n) {
+  n = 0;
+  if(info.Length() <= index || info[index].IsUndefined() ||
+      info[index].IsNull()) {
+    return true;
+  }
+  return readDimensions(info, index, 1, "Transform length", &n);
+}
+
+// fft() function
+// Arguments are (re, im, n, inverse), im may be null for real input and n
+// pads or truncates input, inverse transform is scaled by 1/n
+// --------------------
+Napi::Value NativeModule::fft(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 1) {
+    Napi::TypeError::New(env, "fft expects real part").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t n;
+  std::vector<cd> x;
+  if(!readTransformLength(info, 2, n) || !readComplex(info, 0, n, x)) {
+    return env.Null();
+  }
+  bool inverse = info.Length() > 3 && info[3].ToBoolean();
+
+  std::vector<cd> X(n);
+  fftKernel(*fftPlan(n), x.data(), X.data(), inverse, true);
+  if(inverse && n > 0) {
+    for(size_t k = 0; k < n; ++k) {
+      X[k] /= (double)n;
+    }
+  }
+  return complexResult(env, X.data(), n);
+}
+
+// fft2() function
+// Arguments are (re, im, rows, cols, inverse) for column-major matrix,
+// transforms columns and then rows in parallel
+// --------------------
+Napi::Value NativeModule::fft2(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 4) {
+    Napi::TypeError::New(env, "fft2 expects real part, imaginary part, rows and cols").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t dims[2];
+  if(!readDimensions(info, 2, 2, "Matrix dimensions", dims)) {
+    return env.Null();
+  }
+  size_t rows = dims[0], cols = dims[1], n = 0;
+  std::vector<cd> x;
+  if(!readComplex(info, 0, n, x)) {
+    return env.Null();
+  }
+  if(n != rows * cols) {
+    Napi::RangeError::New(env, "Data must have rows*cols elements").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  bool inverse = info.Length() > 4 && info[4].ToBoolean();
+
+  std::vector<cd> X(n);
+  if(n > 0) {
+    auto column_plan = fftPlan(rows);
+    auto row_plan = fftPlan(cols);
+    parallelFor(cols, [&](size_t j) {
+      fftKernel(*column_plan, x.data() + j * rows, X.data() + j * rows,
+        inverse, false);
+    });
+    parallelFor(rows, [&](size_t i) {
+      std::vector<cd> a(cols), b(cols);
+      for(size_t j = 0; j < cols; ++j) {
+        a[j] = X[j * rows + i];
+      }
+      fftKernel(*row_plan, a.data(), b.data(), inverse, false);
+      for(size_t j = 0; j < cols; ++j) {
+        X[j * rows + i] = inverse ? b[j] / (double)n : b[j];
+      }
+    });
+  }
+  return complexResult(env, X.data(), n);
+}
+
+// rfft() function
+// Arguments are (x, n), returns n/2+1 nonnegative frequency terms
+// --------------------
+Napi::Value NativeModule::rfft(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 1) {
+    Napi::TypeError::New(env, "rfft expects real data").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t nx, n;
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, nx) ||
+      !readTransformLength(info, 1, n)) {
+    return env.Null();
+  }
+  if(n == 0) {
+    n = nx;
+  }
+  std::vector<double> xs;
+  if(n != nx) {
+    xs.assign(n, 0.0);
+    std::copy(x, x + (std::min)(n, nx), xs.begin());
+    x = xs.data();
+  }
+  std::vector<cd> X(n / 2 + 1);
+  if(n > 0) {
+    rfftKernel(x, n, X.data(), true);
+  }
+  return complexResult(env, X.data(), n > 0 ? X.size() : 0);
+}
+
+// irfft() function
+// Arguments are (re, im, n) with n/2+1 terms of Hermitian spectrum,
+// returns n real values
+// --------------------
+Napi::Value NativeModule::irfft(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 1) {
+    Napi::TypeError::New(env, "irfft expects real part").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t nh = 0, n;
+  std::vector<cd> X;
+  if(!readTransformLength(info, 2, n) || !readComplex(info, 0, nh, X)) {
+    return env.Null();
+  }
+  if(n == 0) {
+    n = nh > 0 ? 2 * (nh - 1) : 0;
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n);
+  irfftKernel(X.data(), nh, n, jsResult.Data(), true);
+  return jsResult;
+}
+
+// readSegments() function
+// Reads (x, window, noverlap, nfft) and number of segments
+// --------------------
+bool readSegments(const Napi::CallbackInfo& info, std::vector<double>& x_buffer,
+    const double*& x, size_t& nx, std::vector<double>& w_buffer,
+    const double*& w, size_t& L, size_t& step, size_t& nfft, size_t& K) {
+  Napi::Env env = info.Env();
+  if(info.Length() < 4) {
+    Napi::TypeError::New(env, "Expected data, window, overlap and number of FFT points").ThrowAsJavaScriptException();
+    return false;
+  }
+  size_t dims[2];
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, nx) ||
+      !readNumbers(env, info[1], "Window", w_buffer, w, L) ||
+      !readDimensions(info, 2, 2, "Overlap and number of FFT points", dims)) {
+    return false;
+  }
+  size_t noverlap = dims[0];
+  nfft = dims[1];
+  if(L == 0 || L > nx || noverlap >= L || nfft < L) {
+    Napi::RangeError::New(env, "Window must not be longer than data, overlap must be shorter than window and number of FFT points at least window length").ThrowAsJavaScriptException();
+    return false;
+  }
+  step = L - noverlap;
+  K = (nx - noverlap) / step;
+  return true;
+}
+
+// segmentSpectrum() function
+// One-sided spectrum of windowed and zero padded segment
+// --------------------
+void segmentSpectrum(const double* x, const double* w, size_t L, size_t nfft,
+    std::vector<double>& buffer, cd* out) {
+  buffer.assign(nfft, 0.0);
+  for(size_t k = 0; k < L; ++k) {
+    buffer[k] = x[k] * w[k];
+  }
+  rfftKernel(buffer.data(), nfft, out, false);
+}
+
+// stft() function
+// Arguments are (x, window, noverlap, nfft), returns one-sided short-time
+// transform as column-major matrix with nfft/2+1 rows and column per segment
+// --------------------
+Napi::Value NativeModule::stft(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> x_buffer, w_buffer;
+  const double* x = nullptr;
+  const double* w = nullptr;
+  size_t nx, L, step, nfft, K;
+  if(!readSegments(info, x_buffer, x, nx, w_buffer, w, L, step, nfft, K)) {
+    return env.Null();
+  }
+  size_t rows = nfft / 2 + 1;
+  std::vector<cd> S(rows * K);
+  fftPlan(nfft % 2 ? nfft : nfft / 2);
+  parallelFor(K, [&](size_t j) {
+    std::vector<double> buffer;
+    segmentSpectrum(x + j * step, w, L, nfft, buffer, S.data() + j * rows);
+  });
+  Napi::Object result = complexResult(env, S.data(), S.size());
+  result.Set("rows", Napi::Number::New(env, (double)rows));
+  result.Set("cols", Napi::Number::New(env, (double)K));
+  return result;
+}
+
+// pwelch() function
+// Arguments are (x, window, noverlap, nfft, fs), returns one-sided power
+// spectral density averaged over segments
+// --------------------
+Napi::Value NativeModule::pwelch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> x_buffer, w_buffer;
+  const double* x = nullptr;
+  const double* w = nullptr;
+  size_t nx, L, step, nfft, K;
+  if(!readSegments(info, x_buffer, x, nx, w_buffer, w, L, step, nfft, K)) {
+    return env.Null();
+  }
+  double fs = 1.0;
+  if(info.Length() > 4 && info[4].IsNumber()) {
+    fs = info[4].As<Napi::Number>().DoubleValue();
+  }
+  size_t rows = nfft / 2 + 1;
+
+  // Segments are accumulated in fixed groups to keep summation order
+  size_t groups = (std::min)(K, (size_t)64);
+  std::vector<std::vector<double>> acc(groups, std::vector<double>(rows, 0.0));
+  fftPlan(nfft % 2 ? nfft : nfft / 2);
+  parallelFor(groups, [&](size_t g) {
+    std::vector<double> buffer;
+    std::vector<cd> X(rows);
+    for(size_t j = g; j < K; j += groups) {
+      segmentSpectrum(x + j * step, w, L, nfft, buffer, X.data());
+      for(size_t k = 0; k < rows; ++k) {
+        acc[g][k] += std::norm(X[k]);
+      }
+    }
+  });
+
+  double U = 0;
+  for(size_t k = 0; k < L; ++k) {
+    U += w[k] * w[k];
+  }
+  double scale = 1.0 / ((double)K * fs * U);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, rows);
+  for(size_t k = 0; k < rows; ++k) {
+    double sum = 0;
+    for(size_t g = 0; g < groups; ++g) {
+      sum += acc[g][k];
+    }
+    bool edge = k == 0 || (nfft % 2 == 0 && k == rows - 1);
+    jsResult[k] = sum * scale * (edge ? 1.0 : 2.0);
+  }
+  return jsResult;
+}
+
+}// namespace native_module_ns
@@ -0,0 +1,271 @@
+// JSLAB - native-module-interp.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// interpMethod() function
+// Returns method index or -1 for unknown method
+// --------------------
+int interpMethod(const std::string& method) {
+  static const char* names[] = {"linear", "nearest", "previous", "next", 
+    "pchip", "spline"};
+  for(int i = 0; i < 6; ++i) {
+    if(method == names[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// interpSlopes() function
+// Hermite slopes for pchip (Fritsch-Carlson) and not-a-knot spline, 
+// x must be strictly increasing
+// --------------------
+void interpSlopes(const double* x, const double* y, size_t n, int method, 
+    double* d) {
+  if(n < 2) {
+    if(n == 1) {
+      d[0] = 0;
+    }
+    return;
+  }
+  std::vector<double> h(n - 1), delta(n - 1);
+  for(size_t i = 0; i + 1 < n; ++i) {
+    h[i] = x[i + 1] - x[i];
+    delta[i] = (y[i + 1] - y[i]) / h[i];
+  }
+  if(n == 2) {
+    d[0] = d[1] = delta[0];
+    return;
+  }
+
+  if(method == INTERP_PCHIP) {
+    for(size_t k = 1; k + 1 < n; ++k) {
+      if(delta[k - 1] * delta[k] <= 0) {
+        d[k] = 0;
+      } else {
+        double w1 = 2 * h[k] + h[k - 1], w2 = h[k] + 2 * h[k - 1];
+        d[k] = (w1 + w2) / (w1 / delta[k - 1] + w2 / delta[k]);
+      }
+    }
+    auto endSlope = [](double h0, double h1, double del0, double del1) {
+      double s = ((2 * h0 + h1) * del0 - h0 * del1) / (h0 + h1);
+      if((s > 0) != (del0 > 0) || del0 == 0) {
+        return 0.0;
+      }
+      if((del0 > 0) != (del1 > 0) && std::abs(s) > std::abs(3 * del0)) {
+        return 3 * del0;
+      }
+      return s;
+    };
+    d[0] = endSlope(h[0], h[1], delta[0], delta[1]);
+    d[n - 1] = endSlope(h[n - 2], h[n - 3], delta[n - 2], delta[n - 3]);
+    return;
+  }
+
+  if(n == 3) {
+    // Not-a-knot spline through three points is a parabola
+    double c2 = (delta[1] - delta[0]) / (x[2] - x[0]);
+    d[0] = delta[0] - c2 * h[0];
+    d[1] = delta[0] + c2 * h[0];
+    d[2] = delta[1] + c2 * h[1];
+    return;
+  }
+
+  // Tridiagonal system for slopes solved with Thomas algorithm
+  std::vector<double> a(n), b(n), c(n), r(n);
+  b[0] = h[1];
+  c[0] = h[0] + h[1];
+  r[0] = ((3 * h[0] + 2 * h[1]) * h[1] * delta[0] + h[0] * h[0] * delta[1]) / 
+    (h[0] + h[1]);
+  for(size_t i = 1; i + 1 < n; ++i) {
+    a[i] = h[i];
+    b[i] = 2 * (h[i - 1] + h[i]);
+    c[i] = h[i - 1];
+    r[i] = 3 * (h[i] * delta[i - 1] + h[i - 1] * delta[i]);
+  }
+  a[n - 1] = h[n - 2] + h[n - 3];
+  b[n - 1] = h[n - 3];
+  r[n - 1] = (h[n - 2] * h[n - 2] * delta[n - 3] + 
+    (3 * h[n - 2] + 2 * h[n - 3]) * h[n - 3] * delta[n - 2]) / 
+    (h[n - 2] + h[n - 3]);
+  for(size_t i = 1; i < n; ++i) {
+    double w = a[i] / b[i - 1];
+    b[i] -= w * c[i - 1];
+    r[i] -= w * r[i - 1];
+  }
+  d[n - 1] = r[n - 1] / b[n - 1];
+  for(size_t i = n - 1; i > 0; --i) {
+    d[i - 1] = (r[i - 1] - c[i - 1] * d[i]) / b[i - 1];
+  }
+}
+
+// interpPoint() function
+// Evaluates interpolant on interval i, x[i] <= xq unless xq is left of x[0]
+// --------------------
+inline double interpPoint(const double* x, const double* y, const double* d, 
+    size_t n, int method, size_t i, double xq) {
+  if(i + 1 >= n) {
+    i = n - 1;
+    if(n == 1 || x[i] == xq || method == INTERP_PREVIOUS || 
+        method == INTERP_NEAREST || method == INTERP_NEXT) {
+      return y[i];
+    }
+    i = n - 2;
+  } else if(x[i] == xq) {
+    return y[i];
+  }
+  switch(method) {
+    case INTERP_NEAREST:
+      return xq - x[i] < x[i + 1] - xq ? y[i] : y[i + 1];
+    case INTERP_PREVIOUS:
+      return xq < x[i] ? y[i] : (xq < x[i + 1] ? y[i] : y[i + 1]);
+    case INTERP_NEXT:
+      return xq <= x[i] ? y[i] : y[i + 1];
+    case INTERP_LINEAR:
+      return y[i] + (xq - x[i]) * (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+    default: {
+      double h = x[i + 1] - x[i];
+      double delta = (y[i + 1] - y[i]) / h;
+      double c2 = (3 * delta - 2 * d[i] - d[i + 1]) / h;
+      double c3 = (d[i] + d[i + 1] - 2 * delta) / (h * h);
+      double t = xq - x[i];
+      return y[i] + t * (d[i] + t * (c2 + t * c3));
+    }
+  }
+}
+
+// interp1Kernel() function
+// Interpolation over sorted x, sorted queries are located with merged walk 
+// and unsorted with binary search
+// --------------------
+void interp1Kernel(const double* x, const double* y, const double* d, size_t n, 
+    int method, int extrap, double fill, const double* xq, size_t m, 
+    double* out) {
+  const size_t block = 16384;
+  size_t blocks = (m + block - 1) / block;
+  parallelFor(blocks, [&](size_t b) {
+    size_t start = b * block, end = (std::min)(m, start + block);
+    size_t i = 0;
+    double last = -std::numeric_limits<double>::infinity();
+    for(size_t k = start; k < end; ++k) {
+      double v = xq[k];
+      if(std::isnan(v)) {
+        out[k] = v;
+        continue;
+      }
+      if(v < x[0] || v > x[n - 1]) {
+        if(extrap == INTERP_EXTRAP_FILL) {
+          out[k] = fill;
+          continue;
+        } else if(extrap == INTERP_EXTRAP_CLAMP) {
+          out[k] = v < x[0] ? y[0] : y[n - 1];
+          continue;
+        }
+      }
+      if(v >= last && k > start) {
+        while(i + 1 < n && x[i + 1] <= v) {
+          ++i;
+        }
+      } else {
+        size_t j = std::upper_bound(x, x + n, v) - x;
+        i = j > 0 ? j - 1 : 0;
+      }
+      last = v;
+      out[k] = interpPoint(x, y, d, n, method, i, v);
+    }
+  });
+}
+
+// interp1() function
+// Arguments are (x, y, xq, method, extrap) where extrap is 'extrap', 
+// 'clamp' or fill value (default NaN)
+// --------------------
+Napi::Value NativeModule::interp1(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "interp1 expects x, y and xq").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer, y_buffer, xq_buffer;
+  const double* x = nullptr;
+  const double* y = nullptr;
+  const double* xq = nullptr;
+  size_t n, ny, m;
+  if(!readNumbers(env, info[0], "X", x_buffer, x, n) ||
+      !readNumbers(env, info[1], "Y", y_buffer, y, ny) ||
+      !readNumbers(env, info[2], "Query points", xq_buffer, xq, m)) {
+    return env.Null();
+  }
+  if(n != ny || n == 0) {
+    Napi::RangeError::New(env, "X and Y must have the same nonzero length").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  int method = INTERP_LINEAR;
+  if(info.Length() > 3 && info[3].IsString()) {
+    method = interpMethod(info[3].As<Napi::String>().Utf8Value());
+    if(method < 0) {
+      Napi::TypeError::New(env, "Method must be 'linear', 'nearest', 'previous', 'next', 'pchip' or 'spline'").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+  int extrap = INTERP_EXTRAP_FILL;
+  double fill = std::numeric_limits<double>::quiet_NaN();
+  if(info.Length() > 4 && info[4].IsString()) {
+    std::string mode = info[4].As<Napi::String>().Utf8Value();
+    if(mode == "extrap") {
+      extrap = INTERP_EXTRAP;
+    } else if(mode == "clamp") {
+      extrap = INTERP_EXTRAP_CLAMP;
+    } else if(mode != "none") {
+      Napi::TypeError::New(env, "Extrapolation must be 'extrap', 'clamp', 'none' or fill value").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  } else if(info.Length() > 4 && info[4].IsNumber()) {
+    fill = info[4].As<Napi::Number>().DoubleValue();
+  }
+
+  // Sort samples by x if needed, stable to keep order of repeated values
+  if(!std::is_sorted(x, x + n)) {
+    std::vector<size_t> idx(n);
+    for(size_t i = 0; i < n; ++i) {
+      idx[i] = i;
+    }
+    std::stable_sort(idx.begin(), idx.end(), [x](size_t a, size_t b) {
+      return x[a] < x[b];
+    });
+    std::vector<double> xs(n), ys(n);
+    for(size_t i = 0; i < n; ++i) {
+      xs[i] = x[idx[i]];
+      ys[i] = y[idx[i]];
+    }
+    x_buffer.swap(xs);
+    y_buffer.swap(ys);
+    x = x_buffer.data();
+    y = y_buffer.data();
+  }
+
+  std::vector<double> d;
+  if(method == INTERP_PCHIP || method == INTERP_SPLINE) {
+    for(size_t i = 0; i + 1 < n; ++i) {
+      if(!(x[i + 1] > x[i])) {
+        Napi::RangeError::New(env, "X must contain distinct finite values for pchip and spline").ThrowAsJavaScriptException();
+        return env.Null();
+      }
+    }
+    d.resize(n);
+    interpSlopes(x, y, n, method, d.data());
+  }
+
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, m);
+  interp1Kernel(x, y, d.data(), n, method, extrap, fill, xq, m, jsResult.Data());
+  return jsResult;
+}
+
+}  // namespace native_module_ns
@@ -0,0 +1,603 @@
+// JSLAB - native-module-linalg.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// readMatrix() function
+// Column-major matrix data with required number of elements
+// --------------------
+bool readMatrix(Napi::Env env, const Napi::Value& value, const char* name, 
+    size_t rows, size_t cols, std::vector<double>& buffer, const double*& data) {
+  size_t n = 0;
+  if(!readNumbers(env, value, name, buffer, data, n)) {
+    return false;
+  }
+  if(n != rows * cols) {
+    Napi::RangeError::New(env, std::string(name) + " must have rows*cols elements").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// readDimensions() function
+// Reads count sizes starting at argument first, name is used in error message
+// --------------------
+bool readDimensions(const Napi::CallbackInfo& info, size_t first, size_t count, 
+    const char* name, size_t* dims) {
+  for(size_t i = 0; i < count; ++i) {
+    double value = info.Length() > first + i && info[first + i].IsNumber() ?
+      info[first + i].As<Napi::Number>().DoubleValue() : -1;
+    if(!(value >= 0 && value <= 4294967295.0)) {
+      Napi::TypeError::New(info.Env(), std::string(name) + " must be nonnegative finite numbers").ThrowAsJavaScriptException();
+      return false;
+    }
+    dims[i] = info[first + i].As<Napi::Number>().Uint32Value();
+  }
+  return true;
+}
+
+// matmul() function
+// Arguments are (A, B, m, k, n) for A of size m x k and B of size k x n, 
+// Eigen blocked GEMM is multithreaded when built with OpenMP.
+// --------------------
+Napi::Value NativeModule::matmul(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[3];
+  if(!readDimensions(info, 2, 3, "Matrix dimensions", dims)) {
+    return env.Null();
+  }
+  size_t m = dims[0], k = dims[1], n = dims[2];
+
+  std::vector<double> a_buffer, b_buffer;
+  const double* a = nullptr;
+  const double* b = nullptr;
+  if(!readMatrix(env, info[0], "A", m, k, a_buffer, a) ||
+      !readMatrix(env, info[1], "B", k, n, b_buffer, b)) {
+    return env.Null();
+  }
+
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, m * n);
+  Map<MatrixXd> C(jsResult.Data(), m, n);
+  C.noalias() = Map<const MatrixXd>(a, m, k) * Map<const MatrixXd>(b, k, n);
+  return jsResult;
+}
+
+// factorize() function
+// Arguments are (A, rows, cols, type), returns reusable factorization
+// --------------------
+Napi::Value NativeModule::factorize(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Value type = info.Length() > 3 && info[3].IsString() ? 
+    info[3] : Napi::String::New(env, "lu");
+  return env.GetInstanceData<AddonData>()->denseFactorization.New(
+    {info[0], info[1], info[2], type});
+}
+
+// inv() function
+// Arguments are (A, n), singular or badly conditioned matrix with 
+// reciprocal condition number below machine epsilon throws
+// --------------------
+Napi::Value NativeModule::inv(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t n;
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 1, "Matrix dimensions", &n) ||
+      !readMatrix(env, info[0], "A", n, n, a_buffer, a)) {
+    return env.Null();
+  }
+
+  PartialPivLU<MatrixXd> lu(Map<const MatrixXd>(a, n, n));
+  if(n > 0 && lu.rcond() < std::numeric_limits<double>::epsilon()) {
+    Napi::Error::New(env, "Matrix is singular to working precision").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n * n);
+  Map<MatrixXd>(jsResult.Data(), n, n) = lu.inverse();
+  return jsResult;
+}
+
+// det() function
+// Arguments are (A, n)
+// --------------------
+Napi::Value NativeModule::det(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t n;
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 1, "Matrix dimensions", &n) ||
+      !readMatrix(env, info[0], "A", n, n, a_buffer, a)) {
+    return env.Null();
+  }
+  if(n == 0) {
+    return Napi::Number::New(env, 1.0);
+  }
+  return Napi::Number::New(env, 
+    PartialPivLU<MatrixXd>(Map<const MatrixXd>(a, n, n)).determinant());
+}
+
+// linsolve() function
+// Arguments are (A, B, rows, cols, nrhs), square systems use LU and 
+// rectangular systems are solved in least squares sense with QR.
+// --------------------
+Napi::Value NativeModule::linsolve(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[3];
+  if(!readDimensions(info, 2, 3, "Matrix dimensions", dims)) {
+    return env.Null();
+  }
+  size_t rows = dims[0], cols = dims[1], nrhs = dims[2];
+  std::vector<double> a_buffer, b_buffer;
+  const double* a = nullptr;
+  const double* b = nullptr;
+  if(!readMatrix(env, info[0], "A", rows, cols, a_buffer, a) ||
+      !readMatrix(env, info[1], "B", rows, nrhs, b_buffer, b)) {
+    return env.Null();
+  }
+
+  Map<const MatrixXd> A(a, rows, cols);
+  Map<const MatrixXd> B(b, rows, nrhs);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, cols * nrhs);
+  Map<MatrixXd> X(jsResult.Data(), cols, nrhs);
+  if(rows == cols) {
+    X = PartialPivLU<MatrixXd>(A).solve(B);
+  } else {
+    X = ColPivHouseholderQR<MatrixXd>(A).solve(B);
+  }
+  return jsResult;
+}
+
+// eig() function
+// Arguments are (A, n, symmetric), symmetric matrices use self-adjoint 
+// solver with real eigenvalues in ascending order. Eigenvectors are columns 
+// of column-major arrays, imaginary parts are zero for symmetric input.
+// --------------------
+Napi::Value NativeModule::eig(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t n;
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 1, "Matrix dimensions", &n) ||
+      !readMatrix(env, info[0], "A", n, n, a_buffer, a)) {
+    return env.Null();
+  }
+  Map<const MatrixXd> A(a, n, n);
+  bool symmetric;
+  if(info.Length() > 2 && info[2].IsBoolean()) {
+    symmetric = info[2].As<Napi::Boolean>().Value();
+  } else {
+    symmetric = A.isApprox(A.transpose(), 1e-14);
+  }
+
+  Napi::Float64Array values = Napi::Float64Array::New(env, n);
+  Napi::Float64Array valuesImag = Napi::Float64Array::New(env, n);
+  Napi::Float64Array vectors = Napi::Float64Array::New(env, n * n);
+  Napi::Float64Array vectorsImag = Napi::Float64Array::New(env, n * n);
+  if(symmetric) {
+    SelfAdjointEigenSolver<MatrixXd> solver(A);
+    Map<VectorXd>(values.Data(), n) = solver.eigenvalues();
+    Map<MatrixXd>(vectors.Data(), n, n) = solver.eigenvectors();
+    std::fill(valuesImag.Data(), valuesImag.Data() + n, 0.0);
+    std::fill(vectorsImag.Data(), vectorsImag.Data() + n * n, 0.0);
+  } else {
+    EigenSolver<MatrixXd> solver(A);
+    Map<VectorXd>(values.Data(), n) = solver.eigenvalues().real();
+    Map<VectorXd>(valuesImag.Data(), n) = solver.eigenvalues().imag();
+    Map<MatrixXd>(vectors.Data(), n, n) = solver.eigenvectors().real();
+    Map<MatrixXd>(vectorsImag.Data(), n, n) = solver.eigenvectors().imag();
+  }
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("values", values);
+  jsResult.Set("valuesImag", valuesImag);
+  jsResult.Set("vectors", vectors);
+  jsResult.Set("vectorsImag", vectorsImag);
+  jsResult.Set("symmetric", Napi::Boolean::New(env, symmetric));
+  return jsResult;
+}
+
+// svd() function
+// Arguments are (A, rows, cols, econ), returns U, S and V so that 
+// A = U*diag(S)*V', economy size by default
+// --------------------
+Napi::Value NativeModule::svd(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[2];
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 2, "Matrix dimensions", dims) ||
+      !readMatrix(env, info[0], "A", dims[0], dims[1], a_buffer, a)) {
+    return env.Null();
+  }
+  size_t rows = dims[0], cols = dims[1];
+  bool econ = info.Length() < 4 || info[3].IsUndefined() || info[3].ToBoolean();
+  unsigned int options = econ ? (ComputeThinU | ComputeThinV) : 
+    (ComputeFullU | ComputeFullV);
+  BDCSVD<MatrixXd> solver(Map<const MatrixXd>(a, rows, cols), options);
+
+  const MatrixXd& U = solver.matrixU();
+  const MatrixXd& V = solver.matrixV();
+  const VectorXd& S = solver.singularValues();
+  Napi::Float64Array jsU = Napi::Float64Array::New(env, U.size());
+  Napi::Float64Array jsS = Napi::Float64Array::New(env, S.size());
+  Napi::Float64Array jsV = Napi::Float64Array::New(env, V.size());
+  std::copy(U.data(), U.data() + U.size(), jsU.Data());
+  std::copy(S.data(), S.data() + S.size(), jsS.Data());
+  std::copy(V.data(), V.data() + V.size(), jsV.Data());
+
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("U", jsU);
+  jsResult.Set("S", jsS);
+  jsResult.Set("V", jsV);
+  jsResult.Set("rowsU", Napi::Number::New(env, (double)U.rows()));
+  jsResult.Set("colsU", Napi::Number::New(env, (double)U.cols()));
+  jsResult.Set("rowsV", Napi::Number::New(env, (double)V.rows()));
+  jsResult.Set("colsV", Napi::Number::New(env, (double)V.cols()));
+  return jsResult;
+}
+
+// singularValues() function
+// --------------------
+VectorXd singularValues(const double* a, size_t rows, size_t cols) {
+  return BDCSVD<MatrixXd>(Map<const MatrixXd>(a, rows, cols)).singularValues();
+}
+
+// svdTolerance() function
+// Default tolerance max(rows, cols)*eps(max(S))
+// --------------------
+double svdTolerance(const VectorXd& S, size_t rows, size_t cols) {
+  if(S.size() == 0) {
+    return 0.0;
+  }
+  return (double)(std::max)(rows, cols) * S(0) * 
+    std::numeric_limits<double>::epsilon();
+}
+
+// pinv() function
+// Arguments are (A, rows, cols, tol), result has size cols x rows
+// --------------------
+Napi::Value NativeModule::pinv(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[2];
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 2, "Matrix dimensions", dims) ||
+      !readMatrix(env, info[0], "A", dims[0], dims[1], a_buffer, a)) {
+    return env.Null();
+  }
+  size_t rows = dims[0], cols = dims[1];
+  BDCSVD<MatrixXd> solver(Map<const MatrixXd>(a, rows, cols), 
+    ComputeThinU | ComputeThinV);
+  const VectorXd& S = solver.singularValues();
+  double tol = info.Length() > 3 && info[3].IsNumber() ? 
+    info[3].As<Napi::Number>().DoubleValue() : svdTolerance(S, rows, cols);
+  
+  VectorXd Sinv = S.unaryExpr([tol](double s) { return s > tol ? 1.0 / s : 0.0; });
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, rows * cols);
+  Map<MatrixXd>(jsResult.Data(), cols, rows).noalias() = 
+    solver.matrixV() * Sinv.asDiagonal() * solver.matrixU().transpose();
+  return jsResult;
+}
+
+// rank() function
+// Arguments are (A, rows, cols, tol)
+// --------------------
+Napi::Value NativeModule::rank(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[2];
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 2, "Matrix dimensions", dims) ||
+      !readMatrix(env, info[0], "A", dims[0], dims[1], a_buffer, a)) {
+    return env.Null();
+  }
+  VectorXd S = singularValues(a, dims[0], dims[1]);
+  double tol = info.Length() > 3 && info[3].IsNumber() ? 
+    info[3].As<Napi::Number>().DoubleValue() : svdTolerance(S, dims[0], dims[1]);
+  return Napi::Number::New(env, (double)(S.array() > tol).count());
+}
+
+// cond() function
+// Arguments are (A, rows, cols), 2-norm condition number
+// --------------------
+Napi::Value NativeModule::cond(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t dims[2];
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 2, "Matrix dimensions", dims) ||
+      !readMatrix(env, info[0], "A", dims[0], dims[1], a_buffer, a)) {
+    return env.Null();
+  }
+  VectorXd S = singularValues(a, dims[0], dims[1]);
+  if(S.size() == 0) {
+    return Napi::Number::New(env, 0.0);
+  }
+  double smin = S(S.size() - 1);
+  return Napi::Number::New(env, smin == 0.0 ? 
+    std::numeric_limits<double>::infinity() : S(0) / smin);
+}
+
+// charpolyKernel() function
+// --------------------
+VectorXd charpolyKernel(const MatrixXd& A) {
+  Index n = A.rows();
+  VectorXcd lambda = n > 0 ? EigenSolver<MatrixXd>(A, false).eigenvalues() : VectorXcd();
+  VectorXcd p = VectorXcd::Zero(n + 1);
+  p(0) = 1.0;
+  for(Index k = 0; k < n; ++k) {
+    for(Index i = k + 1; i > 0; --i) {
+      p(i) -= lambda(k) * p(i - 1);
+    }
+  }
+  return p.real();
+}
+
+// charpoly() function
+// Arguments are (A, n), coefficients from eigenvalues starting with 
+// highest degree
+// --------------------
+Napi::Value NativeModule::charpoly(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t n;
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 1, "Matrix dimensions", &n) ||
+      !readMatrix(env, info[0], "A", n, n, a_buffer, a)) {
+    return env.Null();
+  }
+  VectorXd p = charpolyKernel(Map<const MatrixXd>(a, n, n));
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n + 1);
+  std::copy(p.data(), p.data() + n + 1, jsResult.Data());
+  return jsResult;
+}
+
+// expm() function
+// Arguments are (A, n), Pade approximation with scaling and squaring
+// --------------------
+Napi::Value NativeModule::expm(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  size_t n;
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 1, "Matrix dimensions", &n) ||
+      !readMatrix(env, info[0], "A", n, n, a_buffer, a)) {
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n * n);
+  Map<MatrixXd>(jsResult.Data(), n, n) = MatrixXd(Map<const MatrixXd>(a, n, n)).exp();
+  return jsResult;
+}
+
+// DenseFactorization()
+// Object constructor, arguments are (A, rows, cols, type)
+// --------------------
+DenseFactorization::DenseFactorization(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<DenseFactorization>(info) {
+  Napi::Env env = info.Env();
+  this->rows = 0;
+  this->cols = 0;
+
+  size_t dims[2];
+  std::vector<double> a_buffer;
+  const double* a = nullptr;
+  if(!readDimensions(info, 1, 2, "Matrix dimensions", dims) ||
+      !readMatrix(env, info[0], "A", dims[0], dims[1], a_buffer, a)) {
+    return;
+  }
+  std::string type = info.Length() > 3 && info[3].IsString() ?
+    info[3].As<Napi::String>().Utf8Value() : "lu";
+  this->factorize(env, a, dims[0], dims[1], type);
+}
+
+// ~DenseFactorization()
+// Object destructor
+// --------------------
+DenseFactorization::~DenseFactorization() {
+}
+
+// Init() function
+// --------------------
+Napi::Function DenseFactorization::Init(Napi::Env env) {
+  return DefineClass(env, "DenseFactorization", {
+    InstanceMethod("solve", &DenseFactorization::SolveJS),
+    InstanceMethod("inverse", &DenseFactorization::InverseJS),
+    InstanceMethod("det", &DenseFactorization::DeterminantJS),
+    InstanceMethod("rank", &DenseFactorization::RankJS),
+    InstanceMethod("rcond", &DenseFactorization::RcondJS),
+    InstanceMethod("getType", &DenseFactorization::GetTypeJS),
+    InstanceMethod("getSize", &DenseFactorization::GetSizeJS)
+  });
+}
+
+// factorize() function
+// --------------------
+bool DenseFactorization::factorize(Napi::Env env, const double* a, 
+    size_t rows, size_t cols, const std::string& type) {
+  if(type != "qr" && rows != cols) {
+    Napi::RangeError::New(env, "Matrix must be square for '" + type + "' factorization").ThrowAsJavaScriptException();
+    return false;
+  }
+  Map<const MatrixXd> A(a, rows, cols);
+  if(type == "lu") {
+    this->lu.compute(A);
+  } else if(type == "qr") {
+    this->qr.compute(A);
+  } else if(type == "llt" || type == "chol") {
+    this->llt.compute(A);
+    if(this->llt.info() != Success) {
+      Napi::Error::New(env, "Matrix is not positive definite").ThrowAsJavaScriptException();
+      return false;
+    }
+  } else if(type == "ldlt") {
+    this->ldlt.compute(A);
+    if(this->ldlt.info() != Success) {
+      Napi::Error::New(env, "LDLT factorization failed").ThrowAsJavaScriptException();
+      return false;
+    }
+  } else {
+    Napi::TypeError::New(env, "Type must be 'lu', 'qr', 'llt' or 'ldlt'").ThrowAsJavaScriptException();
+    return false;
+  }
+  this->type = type == "chol" ? "llt" : type;
+  this->rows = rows;
+  this->cols = cols;
+  return true;
+}
+
+// solve() function
+// --------------------
+void DenseFactorization::solve(const double* b, size_t nrhs, double* x) {
+  Map<const MatrixXd> B(b, this->rows, nrhs);
+  Map<MatrixXd> X(x, this->cols, nrhs);
+  if(this->type == "lu") {
+    X = this->lu.solve(B);
+  } else if(this->type == "qr") {
+    X = this->qr.solve(B);
+  } else if(this->type == "llt") {
+    X = this->llt.solve(B);
+  } else {
+    X = this->ldlt.solve(B);
+  }
+}
+
+// inverse() function
+// --------------------
+void DenseFactorization::inverse(double* x) {
+  MatrixXd I = MatrixXd::Identity(this->rows, this->rows);
+  this->solve(I.data(), this->rows, x);
+}
+
+// determinant() function
+// --------------------
+double DenseFactorization::determinant(void) {
+  if(this->type == "lu") {
+    return this->lu.determinant();
+  } else if(this->type == "llt") {
+    double d = this->llt.matrixLLT().diagonal().prod();
+    return d * d;
+  } else if(this->type == "ldlt") {
+    return this->ldlt.vectorD().prod();
+  } else if(this->type == "qr") {
+    // A P = Q R, each nontrivial Householder reflection flips sign of Q
+    double d = this->qr.matrixQR().diagonal().prod() * 
+      (double)this->qr.colsPermutation().determinant();
+    const auto& h = this->qr.hCoeffs();
+    for(Index i = 0; i < h.size(); ++i) {
+      if(h(i) != 0) {
+        d = -d;
+      }
+    }
+    return d;
+  }
+  return nan("");
+}
+
+// SolveJS() function
+// --------------------
+Napi::Value DenseFactorization::SolveJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(this->type.empty()) {
+    Napi::Error::New(env, "Factorization is not valid").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  std::vector<double> b_buffer;
+  const double* b = nullptr;
+  size_t n = 0;
+  if(info.Length() < 1 || !readNumbers(env, info[0], "B", b_buffer, b, n)) {
+    return env.Null();
+  }
+  if(this->rows == 0 || n % this->rows != 0) {
+    Napi::RangeError::New(env, "Number of elements of B must be a multiple of rows").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t nrhs = n / this->rows;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, this->cols * nrhs);
+  this->solve(b, nrhs, jsResult.Data());
+  return jsResult;
+}
+
+// InverseJS() function
+// --------------------
+Napi::Value DenseFactorization::InverseJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(this->type.empty() || this->rows != this->cols) {
+    Napi::Error::New(env, "Inverse requires valid square factorization").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, this->rows * this->cols);
+  this->inverse(jsResult.Data());
+  return jsResult;
+}
+
+// DeterminantJS() function
+// --------------------
+Napi::Value DenseFactorization::DeterminantJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(this->type == "qr" && this->rows != this->cols) {
+    Napi::Error::New(env, "Determinant requires square matrix").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  return Napi::Number::New(env, this->determinant());
+}
+
+// RankJS() function
+// --------------------
+Napi::Value DenseFactorization::RankJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(this->type != "qr") {
+    Napi::Error::New(env, "Rank is available only for 'qr' factorization").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  return Napi::Number::New(env, (double)this->qr.rank());
+}
+
+// RcondJS() function
+// --------------------
+Napi::Value DenseFactorization::RcondJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(this->type == "lu") {
+    return Napi::Number::New(env, this->lu.rcond());
+  } else if(this->type == "llt") {
+    return Napi::Number::New(env, this->llt.rcond());
+  } else if(this->type == "ldlt") {
+    return Napi::Number::New(env, this->ldlt.rcond());
+  }
+  Napi::Error::New(env, "Reciprocal condition number is not available for this factorization").ThrowAsJavaScriptException();
+  return env.Null();
+}
+
+// GetTypeJS() function
+// --------------------
+Napi::Value DenseFactorization::GetTypeJS(const Napi::CallbackInfo& info) {
+  return Napi::String::New(info.Env(), this->type);
+}
+
+// GetSizeJS() function
+// --------------------
+Napi::Value DenseFactorization::GetSizeJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Array jsResult = Napi::Array::New(env, 2);
+  jsResult.Set((uint32_t)0, Napi::Number::New(env, (double)this->rows));
+  jsResult.Set((uint32_t)1, Napi::Number::New(env, (double)this->cols));
+  return jsResult;
+}
+
+}  // namespace native_module_ns
@@ -0,0 +1,683 @@
+// JSLAB - native-module-ndarray.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+const size_t NDARRAY_PARALLEL = 65536;
+
+// readIntegers() function
+// Reads array of integers, nonnegative unless negative values are allowed
+// --------------------
+bool readIntegers(Napi::Env env, const Napi::Value& value, const char* name,
+    bool allow_negative, std::vector<ptrdiff_t>& out) {
+  std::vector<double> buffer;
+  const double* data = nullptr;
+  size_t n;
+  if(!readNumbers(env, value, name, buffer, data, n)) {
+    return false;
+  }
+  out.resize(n);
+  for(size_t i = 0; i < n; ++i) {
+    if(data[i] != std::floor(data[i]) || (!allow_negative && data[i] < 0)) {
+      Napi::RangeError::New(env, std::string(name) + " must contain " +
+        (allow_negative ? "integers" : "nonnegative integers")).ThrowAsJavaScriptException();
+      return false;
+    }
+    out[i] = (ptrdiff_t)data[i];
+  }
+  return true;
+}
+
+// contiguousStrides() function
+// Column-major strides of shape, first dimension is contiguous
+// --------------------
+std::vector<ptrdiff_t> contiguousStrides(const std::vector<size_t>& shape) {
+  std::vector<ptrdiff_t> strides(shape.size());
+  ptrdiff_t stride = 1;
+  for(size_t d = 0; d < shape.size(); ++d) {
+    strides[d] = stride;
+    stride *= (ptrdiff_t)shape[d];
+  }
+  return strides;
+}
+
+// stridedFor() function
+// Visits elements of two strided operands of same shape in column-major
+// order, fun(ia, ib, k) receives element offsets and linear index, outer
+// dimensions are split among threads for large arrays when parallel is set
+// --------------------
+template<typename F>
+void stridedFor(const std::vector<size_t>& shape, const ptrdiff_t* sa,
+    const ptrdiff_t* sb, F fun, bool parallel = true) {
+  size_t rank = shape.size();
+  size_t inner = shape[0];
+  size_t outer = 1;
+  for(size_t d = 1; d < rank; ++d) {
+    outer *= shape[d];
+  }
+  if(inner == 0 || outer == 0) {
+    return;
+  }
+  auto visit = [&](size_t o_first, size_t o_last) {
+    for(size_t o = o_first; o < o_last; ++o) {
+      ptrdiff_t ia = 0, ib = 0;
+      size_t rest = o;
+      for(size_t d = 1; d < rank; ++d) {
+        size_t i = rest % shape[d];
+        rest /= shape[d];
+        ia += (ptrdiff_t)i * sa[d];
+        ib += (ptrdiff_t)i * sb[d];
+      }
+      size_t k = o * inner;
+      for(size_t i = 0; i < inner; ++i) {
+        fun(ia + (ptrdiff_t)i * sa[0], ib + (ptrdiff_t)i * sb[0], k + i);
+      }
+    }
+  };
+  if(!parallel || inner * outer < NDARRAY_PARALLEL || outer < 2) {
+    visit(0, outer);
+    return;
+  }
+  size_t chunk = (std::max)((size_t)1, NDARRAY_PARALLEL / inner);
+  size_t chunks = (outer + chunk - 1) / chunk;
+  parallelFor(chunks, [&](size_t c) {
+    visit(c * chunk, (std::min)(outer, (c + 1) * chunk));
+  });
+}
+
+// ndarrayBinary() function
+// Returns binary elementwise operation or nullptr for unknown name
+// --------------------
+double (*ndarrayBinary(const std::string& op))(double, double) {
+  if(op == "set") return [](double, double b) { return b; };
+  if(op == "add") return [](double a, double b) { return a + b; };
+  if(op == "sub") return [](double a, double b) { return a - b; };
+  if(op == "mul") return [](double a, double b) { return a * b; };
+  if(op == "div") return [](double a, double b) { return a / b; };
+  if(op == "pow") return [](double a, double b) { return std::pow(a, b); };
+  if(op == "min") return [](double a, double b) { return (std::min)(a, b); };
+  if(op == "max") return [](double a, double b) { return (std::max)(a, b); };
+  return nullptr;
+}
+
+// ndarrayUnary() function
+// Returns unary elementwise operation or nullptr for unknown name
+// --------------------
+double (*ndarrayUnary(const std::string& op))(double) {
+  if(op == "neg") return [](double a) { return -a; };
+  if(op == "abs") return [](double a) { return std::abs(a); };
+  if(op == "sqrt") return [](double a) { return std::sqrt(a); };
+  if(op == "exp") return [](double a) { return std::exp(a); };
+  if(op == "log") return [](double a) { return std::log(a); };
+  if(op == "sin") return [](double a) { return std::sin(a); };
+  if(op == "cos") return [](double a) { return std::cos(a); };
+  if(op == "tan") return [](double a) { return std::tan(a); };
+  if(op == "round") return [](double a) { return std::round(a); };
+  if(op == "floor") return [](double a) { return std::floor(a); };
+  if(op == "ceil") return [](double a) { return std::ceil(a); };
+  if(op == "reciprocal") return [](double a) { return 1.0 / a; };
+  return nullptr;
+}
+
+// ndarray() function
+// Arguments are (data, shape, strides, offset), returns native strided
+// array, Float64Array data is shared and not copied
+// --------------------
+Napi::Value NativeModule::ndarray(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  std::vector<napi_value> args;
+  for(size_t i = 0; i < info.Length(); ++i) {
+    args.push_back(info[i]);
+  }
+  return env.GetInstanceData<AddonData>()->nativeArray.New(args);
+}
+
+// NativeArray()
+// Object constructor, arguments are (data, shape, strides, offset) with
+// strides and offset in elements, column-major strides are default
+// --------------------
+NativeArray::NativeArray(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<NativeArray>(info) {
+  Napi::Env env = info.Env();
+  this->offset = 0;
+
+  Napi::Float64Array data;
+  if(info.Length() > 0 && info[0].IsTypedArray() &&
+      info[0].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+    data = info[0].As<Napi::Float64Array>();
+  } else {
+    std::vector<double> buffer;
+    const double* values = nullptr;
+    size_t n;
+    if(info.Length() < 1 || !readNumbers(env, info[0], "Data", buffer, values, n)) {
+      return;
+    }
+    data = Napi::Float64Array::New(env, n);
+    std::copy(values, values + n, data.Data());
+  }
+  size_t length = data.ElementLength();
+
+  std::vector<ptrdiff_t> shape;
+  if(info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull()) {
+    if(!readIntegers(env, info[1], "Shape", false, shape)) {
+      return;
+    }
+  } else {
+    shape.push_back((ptrdiff_t)length);
+  }
+  if(shape.empty()) {
+    shape.push_back(1);
+  }
+  this->shape.assign(shape.begin(), shape.end());
+  if(info.Length() > 2 && !info[2].IsUndefined() && !info[2].IsNull()) {
+    if(!readIntegers(env, info[2], "Strides", true, this->strides)) {
+      return;
+    }
+    if(this->strides.size() != this->shape.size()) {
+      Napi::RangeError::New(env, "Number of strides must match number of dimensions").ThrowAsJavaScriptException();
+      return;
+    }
+    for(size_t d = 0; d < this->shape.size(); ++d) {
+      if(this->strides[d] == 0 && this->shape[d] > 1) {
+        Napi::RangeError::New(env, "Strides must not be zero for dimensions longer than one").ThrowAsJavaScriptException();
+        return;
+      }
+    }
+  } else {
+    this->strides = contiguousStrides(this->shape);
+  }
+  if(info.Length() > 3 && info[3].IsNumber()) {
+    double value = info[3].As<Napi::Number>().DoubleValue();
+    if(value < 0 || value != std::floor(value)) {
+      Napi::RangeError::New(env, "Offset must be nonnegative integer").ThrowAsJavaScriptException();
+      return;
+    }
+    this->offset = (size_t)value;
+  }
+
+  // All reachable elements must be inside of buffer
+  if(this->numel() > 0) {
+    ptrdiff_t lo = (ptrdiff_t)this->offset, hi = (ptrdiff_t)this->offset;
+    for(size_t d = 0; d < this->shape.size(); ++d) {
+      ptrdiff_t extent = ((ptrdiff_t)this->shape[d] - 1) * this->strides[d];
+      (extent < 0 ? lo : hi) += extent;
+    }
+    if(lo < 0 || hi >= (ptrdiff_t)length) {
+      Napi::RangeError::New(env, "Shape and strides exceed data length").ThrowAsJavaScriptException();
+      return;
+    }
+  }
+  this->buffer = Napi::Persistent(data);
+}
+
+// ~NativeArray()
+// Object destructor
+// --------------------
+NativeArray::~NativeArray() {
+}
+
+// Init() function
+// --------------------
+Napi::Function NativeArray::Init(Napi::Env env) {
+  return DefineClass(env, "NativeArray", {
+    InstanceMethod("getShape", &NativeArray::GetShapeJS),
+    InstanceMethod("getStrides", &NativeArray::GetStridesJS),
+    InstanceMethod("getOffset", &NativeArray::GetOffsetJS),
+    InstanceMethod("isContiguous", &NativeArray::IsContiguousJS),
+    InstanceMethod("buffer", &NativeArray::BufferJS),
+    InstanceMethod("toFloat64Array", &NativeArray::ToFloat64ArrayJS),
+    InstanceMethod("copy", &NativeArray::CopyJS),
+    InstanceMethod("view", &NativeArray::ViewJS),
+    InstanceMethod("permute", &NativeArray::PermuteJS),
+    InstanceMethod("reshape", &NativeArray::ReshapeJS),
+    InstanceMethod("gather", &NativeArray::GatherJS),
+    InstanceMethod("scatter", &NativeArray::ScatterJS),
+    InstanceMethod("apply", &NativeArray::ApplyJS),
+    InstanceMethod("map", &NativeArray::MapJS)
+  });
+}
+
+// numel() function
+// --------------------
+size_t NativeArray::numel() const {
+  size_t n = 1;
+  for(size_t s : this->shape) {
+    n *= s;
+  }
+  return n;
+}
+
+// isContiguous() function
+// True when elements are stored column-major without gaps
+// --------------------
+bool NativeArray::isContiguous() const {
+  ptrdiff_t stride = 1;
+  for(size_t d = 0; d < this->shape.size(); ++d) {
+    if(this->shape[d] != 1 && this->strides[d] != stride) {
+      return false;
+    }
+    stride *= (ptrdiff_t)this->shape[d];
+  }
+  return true;
+}
+
+// isDisjoint() function
+// True when no two elements can share memory, checked by requiring each
+// stride to exceed extent of all smaller strides, holds for contiguous
+// arrays and their views and permutations
+// --------------------
+bool NativeArray::isDisjoint() const {
+  std::vector<std::pair<ptrdiff_t, size_t>> dims;
+  for(size_t d = 0; d < this->shape.size(); ++d) {
+    if(this->shape[d] > 1) {
+      dims.push_back({std::abs(this->strides[d]), this->shape[d]});
+    }
+  }
+  std::sort(dims.begin(), dims.end());
+  ptrdiff_t extent = 0;
+  for(const auto& dim : dims) {
+    if(dim.first <= extent) {
+      return false;
+    }
+    extent += dim.first * (ptrdiff_t)(dim.second - 1);
+  }
+  return true;
+}
+
+// data() function
+// Pointer to first element of view
+// --------------------
+double* NativeArray::data() {
+  return this->buffer.Value().Data() + this->offset;
+}
+
+// elementOffset() function
+// Offset of element with column-major linear index relative to data()
+// --------------------
+ptrdiff_t NativeArray::elementOffset(size_t k) const {
+  ptrdiff_t o = 0;
+  for(size_t d = 0; d < this->shape.size(); ++d) {
+    o += (ptrdiff_t)(k % this->shape[d]) * this->strides[d];
+    k /= this->shape[d];
+  }
+  return o;
+}
+
+// overlaps() function
+// True when memory of n elements at p overlaps buffer of array
+// --------------------
+bool NativeArray::overlaps(const double* p, size_t n) {
+  Napi::Float64Array data = this->buffer.Value();
+  const double* lo = data.Data();
+  const double* hi = lo + data.ElementLength();
+  return n > 0 && p < hi && p + n > lo;
+}
+
+// copyTo() function
+// Copies elements to contiguous column-major output
+// --------------------
+void NativeArray::copyTo(double* out) {
+  const double* a = this->data();
+  if(this->isContiguous()) {
+    std::copy(a, a + this->numel(), out);
+    return;
+  }
+  stridedFor(this->shape, this->strides.data(), this->strides.data(),
+    [&](ptrdiff_t ia, ptrdiff_t, size_t k) {
+      out[k] = a[ia];
+    });
+}
+
+// create() function
+// Creates new native array object over data with given layout
+// --------------------
+Napi::Value NativeArray::create(Napi::Env env, Napi::Float64Array data,
+    const std::vector<size_t>& shape, const std::vector<ptrdiff_t>& strides,
+    size_t offset) {
+  Napi::Array jsShape = Napi::Array::New(env, shape.size());
+  Napi::Array jsStrides = Napi::Array::New(env, strides.size());
+  for(uint32_t d = 0; d < shape.size(); ++d) {
+    jsShape.Set(d, Napi::Number::New(env, (double)shape[d]));
+    jsStrides.Set(d, Napi::Number::New(env, (double)strides[d]));
+  }
+  return env.GetInstanceData<AddonData>()->nativeArray.New(
+    {data, jsShape, jsStrides, Napi::Number::New(env, (double)offset)});
+}
+
+// GetShapeJS() function
+// --------------------
+Napi::Value NativeArray::GetShapeJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Array jsResult = Napi::Array::New(env, this->shape.size());
+  for(uint32_t d = 0; d < this->shape.size(); ++d) {
+    jsResult.Set(d, Napi::Number::New(env, (double)this->shape[d]));
+  }
+  return jsResult;
+}
+
+// GetStridesJS() function
+// --------------------
+Napi::Value NativeArray::GetStridesJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Array jsResult = Napi::Array::New(env, this->strides.size());
+  for(uint32_t d = 0; d < this->strides.size(); ++d) {
+    jsResult.Set(d, Napi::Number::New(env, (double)this->strides[d]));
+  }
+  return jsResult;
+}
+
+// GetOffsetJS() function
+// --------------------
+Napi::Value NativeArray::GetOffsetJS(const Napi::CallbackInfo& info) {
+  return Napi::Number::New(info.Env(), (double)this->offset);
+}
+
+// IsContiguousJS() function
+// --------------------
+Napi::Value NativeArray::IsContiguousJS(const Napi::CallbackInfo& info) {
+  return Napi::Boolean::New(info.Env(), this->isContiguous());
+}
+
+// BufferJS() function
+// Returns shared Float64Array that holds elements of array
+// --------------------
+Napi::Value NativeArray::BufferJS(const Napi::CallbackInfo&) {
+  return this->buffer.Value();
+}
+
+// ToFloat64ArrayJS() function
+// Returns elements copied in column-major order
+// --------------------
+Napi::Value NativeArray::ToFloat64ArrayJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, this->numel());
+  this->copyTo(jsResult.Data());
+  return jsResult;
+}
+
+// CopyJS() function
+// Returns contiguous copy with own data
+// --------------------
+Napi::Value NativeArray::CopyJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Float64Array data = Napi::Float64Array::New(env, this->numel());
+  this->copyTo(data.Data());
+  return create(env, data, this->shape, contiguousStrides(this->shape), 0);
+}
+
+// ViewJS() function
+// Arguments are (start, stop, step) with one entry per dimension, stop is
+// exclusive and step may be negative, returned view shares data
+// --------------------
+Napi::Value NativeArray::ViewJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t rank = this->shape.size();
+  std::vector<ptrdiff_t> start, stop, step(rank, 1);
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "view expects start and stop").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readIntegers(env, info[0], "Start", true, start) ||
+      !readIntegers(env, info[1], "Stop", true, stop) ||
+      (info.Length() > 2 && !info[2].IsUndefined() &&
+        !readIntegers(env, info[2], "Step", true, step))) {
+    return env.Null();
+  }
+  if(start.size() != rank || stop.size() != rank || step.size() != rank) {
+    Napi::RangeError::New(env, "Start, stop and step must have one entry per dimension").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  std::vector<size_t> shape(rank);
+  std::vector<ptrdiff_t> strides(rank);
+  ptrdiff_t offset = (ptrdiff_t)this->offset;
+  for(size_t d = 0; d < rank; ++d) {
+    ptrdiff_t n = (ptrdiff_t)this->shape[d];
+    if(step[d] == 0) {
+      Napi::RangeError::New(env, "Step must not be zero").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    ptrdiff_t count = step[d] > 0 ?
+      (stop[d] - start[d] + step[d] - 1) / step[d] :
+      (start[d] - stop[d] - step[d] - 1) / -step[d];
+    count = (std::max)(count, (ptrdiff_t)0);
+    if(count > 0 && (start[d] < 0 || start[d] >= n ||
+        start[d] + (count - 1) * step[d] < 0 ||
+        start[d] + (count - 1) * step[d] >= n)) {
+      Napi::RangeError::New(env, "View is out of bounds").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    shape[d] = (size_t)count;
+    strides[d] = this->strides[d] * step[d];
+    if(count > 0) {
+      offset += start[d] * this->strides[d];
+    }
+  }
+  return create(env, this->buffer.Value(), shape, strides, (size_t)offset);
+}
+
+// PermuteJS() function
+// Argument is permutation of dimensions, returned view shares data
+// --------------------
+Napi::Value NativeArray::PermuteJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t rank = this->shape.size();
+  std::vector<ptrdiff_t> perm;
+  if(rank == 2 && (info.Length() < 1 || info[0].IsUndefined())) {
+    perm = {1, 0};
+  } else if(info.Length() < 1 ||
+      !readIntegers(env, info[0], "Permutation", false, perm)) {
+    return env.Null();
+  }
+  std::vector<bool> used(rank, false);
+  std::vector<size_t> shape(rank);
+  std::vector<ptrdiff_t> strides(rank);
+  for(size_t d = 0; d < perm.size(); ++d) {
+    if(perm.size() != rank || (size_t)perm[d] >= rank || used[perm[d]]) {
+      Napi::RangeError::New(env, "Invalid permutation of dimensions").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    used[perm[d]] = true;
+    shape[d] = this->shape[perm[d]];
+    strides[d] = this->strides[perm[d]];
+  }
+  return create(env, this->buffer.Value(), shape, strides, this->offset);
+}
+
+// ReshapeJS() function
+// Argument is new shape, contiguous arrays are reshaped without copy
+// --------------------
+Napi::Value NativeArray::ReshapeJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  std::vector<ptrdiff_t> dims;
+  if(info.Length() < 1 || !readIntegers(env, info[0], "Shape", false, dims)) {
+    return env.Null();
+  }
+  std::vector<size_t> shape(dims.begin(), dims.end());
+  if(shape.empty()) {
+    shape.push_back(1);
+  }
+  size_t n = 1;
+  for(size_t s : shape) {
+    n *= s;
+  }
+  if(n != this->numel()) {
+    Napi::RangeError::New(env, "Number of elements must not change").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(this->isContiguous()) {
+    return create(env, this->buffer.Value(), shape, contiguousStrides(shape),
+      this->offset);
+  }
+  Napi::Float64Array data = Napi::Float64Array::New(env, n);
+  this->copyTo(data.Data());
+  return create(env, data, shape, contiguousStrides(shape), 0);
+}
+
+// readLinearIndices() function
+// Reads column-major linear indices and checks bounds
+// --------------------
+bool readLinearIndices(Napi::Env env, const Napi::Value& value, size_t numel,
+    std::vector<double>& buffer, const double*& indices, size_t& n) {
+  if(!readNumbers(env, value, "Indices", buffer, indices, n)) {
+    return false;
+  }
+  for(size_t i = 0; i < n; ++i) {
+    if(!(indices[i] >= 0 && indices[i] < (double)numel) ||
+        indices[i] != std::floor(indices[i])) {
+      Napi::RangeError::New(env, "Index exceeds number of elements").ThrowAsJavaScriptException();
+      return false;
+    }
+  }
+  return true;
+}
+
+// GatherJS() function
+// Argument is array of column-major linear indices, returns elements
+// --------------------
+Napi::Value NativeArray::GatherJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  std::vector<double> buffer;
+  const double* indices = nullptr;
+  size_t n;
+  if(info.Length() < 1 ||
+      !readLinearIndices(env, info[0], this->numel(), buffer, indices, n)) {
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n);
+  const double* a = this->data();
+  double* y = jsResult.Data();
+  for(size_t i = 0; i < n; ++i) {
+    y[i] = a[this->elementOffset((size_t)indices[i])];
+  }
+  return jsResult;
+}
+
+// ScatterJS() function
+// Arguments are (indices, values) where values is array of same length or
+// scalar, elements are written in place
+// --------------------
+Napi::Value NativeArray::ScatterJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  std::vector<double> i_buffer, v_buffer;
+  const double* indices = nullptr;
+  const double* values = nullptr;
+  size_t n, nv = 1;
+  if(info.Length() < 2 ||
+      !readLinearIndices(env, info[0], this->numel(), i_buffer, indices, n)) {
+    return env.Null();
+  }
+  bool is_scalar = info[1].IsNumber();
+  double scalar = 0;
+  if(is_scalar) {
+    scalar = info[1].As<Napi::Number>().DoubleValue();
+  } else if(!readNumbers(env, info[1], "Values", v_buffer, values, nv)) {
+    return env.Null();
+  } else if(nv != n) {
+    Napi::RangeError::New(env, "Number of values must match number of indices").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double* a = this->data();
+  for(size_t i = 0; i < n; ++i) {
+    a[this->elementOffset((size_t)indices[i])] = is_scalar ? scalar : values[i];
+  }
+  return info.This();
+}
+
+// ApplyJS() function
+// Arguments are (op, operand) where op is 'set', 'add', 'sub', 'mul', 'div',
+// 'pow', 'min' or 'max' and operand is scalar, native array or array of
+// same number of elements, result is written in place
+// --------------------
+Napi::Value NativeArray::ApplyJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(info.Length() < 2 || !info[0].IsString()) {
+    Napi::TypeError::New(env, "apply expects operation and operand").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  auto fun = ndarrayBinary(info[0].As<Napi::String>().Utf8Value());
+  if(!fun) {
+    Napi::TypeError::New(env, "Operation must be 'set', 'add', 'sub', 'mul', 'div', 'pow', 'min' or 'max'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double* a = this->data();
+  size_t n = this->numel();
+  bool parallel = this->isDisjoint();
+
+  if(info[1].IsNumber()) {
+    double b = info[1].As<Napi::Number>().DoubleValue();
+    stridedFor(this->shape, this->strides.data(), this->strides.data(),
+      [&](ptrdiff_t ia, ptrdiff_t, size_t) {
+        a[ia] = fun(a[ia], b);
+      }, parallel);
+    return info.This();
+  }
+
+  // Operand sharing data is copied first so that overlapping views give
+  // same result as separate arrays
+  std::vector<double> b_buffer;
+  const double* b = nullptr;
+  const ptrdiff_t* sb = nullptr;
+  std::vector<ptrdiff_t> contiguous = contiguousStrides(this->shape);
+  size_t nb;
+  if(info[1].IsObject() && info[1].As<Napi::Object>().InstanceOf(
+      env.GetInstanceData<AddonData>()->nativeArray.Value())) {
+    NativeArray* other = NativeArray::Unwrap(info[1].As<Napi::Object>());
+    if(other->shape != this->shape) {
+      Napi::RangeError::New(env, "Operands must have same shape").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    if(this->overlaps(other->buffer.Value().Data(), 
+        other->buffer.Value().ElementLength())) {
+      b_buffer.resize(n);
+      other->copyTo(b_buffer.data());
+      b = b_buffer.data();
+      sb = contiguous.data();
+    } else {
+      b = other->data();
+      sb = other->strides.data();
+    }
+  } else if(!readNumbers(env, info[1], "Operand", b_buffer, b, nb)) {
+    return env.Null();
+  } else if(nb != n) {
+    Napi::RangeError::New(env, "Operands must have same number of elements").ThrowAsJavaScriptException();
+    return env.Null();
+  } else {
+    if(b_buffer.empty() && this->overlaps(b, nb)) {
+      b_buffer.assign(b, b + nb);
+      b = b_buffer.data();
+    }
+    sb = contiguous.data();
+  }
+  stridedFor(this->shape, this->strides.data(), sb,
+    [&](ptrdiff_t ia, ptrdiff_t ib, size_t) {
+      a[ia] = fun(a[ia], b[ib]);
+    }, parallel);
+  return info.This();
+}
+
+// MapJS() function
+// Argument is unary operation name, result is written in place
+// --------------------
+Napi::Value NativeArray::MapJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  auto fun = info.Length() > 0 && info[0].IsString() ?
+    ndarrayUnary(info[0].As<Napi::String>().Utf8Value()) : nullptr;
+  if(!fun) {
+    Napi::TypeError::New(env, "Operation must be 'neg', 'abs', 'sqrt', 'exp', 'log', 'sin', 'cos', 'tan', 'round', 'floor', 'ceil' or 'reciprocal'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double* a = this->data();
+  stridedFor(this->shape, this->strides.data(), this->strides.data(),
+    [&](ptrdiff_t ia, ptrdiff_t, size_t) {
+      a[ia] = fun(a[ia]);
+    }, this->isDisjoint());
+  return info.This();
+}
+
+}// namespace native_module_ns
@@ -0,0 +1,379 @@
+// JSLAB - native-module-poly.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// polyVandermonde() function
+// Vandermonde matrix with columns x^n ... x^0, x is centered and scaled
+// as (x - mu[0]) / mu[1] when mu is given
+// --------------------
+void polyVandermonde(const double* x, size_t m, int n, const double* mu,
+    MatrixXd& V) {
+  V.resize(m, n + 1);
+  for(size_t k = 0; k < m; ++k) {
+    double v = mu ? (x[k] - mu[0]) / mu[1] : x[k];
+    double a = 1.0;
+    for(int j = n; j >= 0; --j) {
+      V(k, j) = a;
+      a *= v;
+    }
+  }
+}
+
+// polyvalKernel() function
+// Horner evaluation over blocks of points, inner loop runs over points so
+// compiler can vectorize it
+// --------------------
+void polyvalKernel(const double* p, size_t np, const double* x, size_t m,
+    const double* mu, double* y) {
+  const size_t block = 1024;
+  double xs[block];
+  for(size_t start = 0; start < m; start += block) {
+    size_t len = (std::min)(block, m - start);
+    const double* xb = x + start;
+    double* yb = y + start;
+    if(mu) {
+      for(size_t k = 0; k < len; ++k) {
+        xs[k] = (xb[k] - mu[0]) / mu[1];
+      }
+      xb = xs;
+    }
+    double c = np > 0 ? p[0] : 0.0;
+    for(size_t k = 0; k < len; ++k) {
+      yb[k] = c;
+    }
+    for(size_t i = 1; i < np; ++i) {
+      c = p[i];
+      for(size_t k = 0; k < len; ++k) {
+        yb[k] = yb[k] * xb[k] + c;
+      }
+    }
+  }
+}
+
+// readPolyCenter() function
+// Reads centering flag and computes mu as mean and standard deviation of x
+// --------------------
+bool readPolyCenter(const Napi::CallbackInfo& info, size_t index,
+    const double* x, size_t m, double* mu) {
+  if(info.Length() <= index || !info[index].ToBoolean()) {
+    return false;
+  }
+  double mean = 0;
+  for(size_t k = 0; k < m; ++k) {
+    mean += x[k];
+  }
+  mean /= m;
+  double ss = 0;
+  for(size_t k = 0; k < m; ++k) {
+    ss += (x[k] - mean) * (x[k] - mean);
+  }
+  mu[0] = mean;
+  mu[1] = m > 1 ? std::sqrt(ss / (m - 1)) : 0.0;
+  if(!(mu[1] > 0)) {
+    mu[1] = 1.0;
+  }
+  return true;
+}
+
+// readPolyMu() function
+// Reads optional [mean, std] pair used to center and scale x
+// --------------------
+bool readPolyMu(Napi::Env env, const Napi::Value& value,
+    std::vector<double>& buffer, const double*& mu, bool& ok) {
+  ok = true;
+  if(value.IsUndefined() || value.IsNull()) {
+    return false;
+  }
+  size_t n;
+  if(!readNumbers(env, value, "Mu", buffer, mu, n)) {
+    ok = false;
+    return false;
+  }
+  if(n != 2) {
+    Napi::RangeError::New(env, "Mu must contain mean and standard deviation").ThrowAsJavaScriptException();
+    ok = false;
+    return false;
+  }
+  return true;
+}
+
+// readPolyDegree() function
+// --------------------
+bool readPolyDegree(Napi::Env env, const Napi::Value& value, int& n) {
+  if(!value.IsNumber()) {
+    Napi::TypeError::New(env, "Degree must be a number").ThrowAsJavaScriptException();
+    return false;
+  }
+  double d = value.As<Napi::Number>().DoubleValue();
+  if(!(d >= 0) || d != std::floor(d) || d > 1e6) {
+    Napi::RangeError::New(env, "Degree must be a nonnegative integer").ThrowAsJavaScriptException();
+    return false;
+  }
+  n = (int)d;
+  return true;
+}
+
+// polyfit() function
+// Arguments are (x, y, n, center), least squares fit with column pivoting
+// QR, returns coefficients, triangular factor R, degrees of freedom, norm
+// of residuals, rank and mu
+// --------------------
+Napi::Value NativeModule::polyfit(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "polyfit expects x, y and degree").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer, y_buffer;
+  const double* x = nullptr;
+  const double* y = nullptr;
+  size_t m, ny;
+  int n;
+  if(!readNumbers(env, info[0], "X", x_buffer, x, m) ||
+      !readNumbers(env, info[1], "Y", y_buffer, y, ny) ||
+      !readPolyDegree(env, info[2], n)) {
+    return env.Null();
+  }
+  if(m != ny || m == 0) {
+    Napi::RangeError::New(env, "X and Y must have the same nonzero length").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double mu[2];
+  bool center = readPolyCenter(info, 3, x, m, mu);
+
+  MatrixXd V;
+  polyVandermonde(x, m, n, center ? mu : nullptr, V);
+  Map<const VectorXd> Y(y, m);
+  ColPivHouseholderQR<MatrixXd> qr(V);
+  VectorXd p = qr.solve(Y);
+  double normr = (Y - V * p).norm();
+
+  // Unpivoted triangular factor as used for error estimates
+  size_t np = n + 1;
+  HouseholderQR<MatrixXd> hqr(V);
+  size_t rows = (std::min)(m, np);
+  Napi::Float64Array jsR = Napi::Float64Array::New(env, np * np);
+  for(size_t j = 0; j < np; ++j) {
+    for(size_t i = 0; i < np; ++i) {
+      jsR[j * np + i] = (i < rows && j >= i) ? hqr.matrixQR()(i, j) : 0.0;
+    }
+  }
+
+  Napi::Float64Array jsP = Napi::Float64Array::New(env, np);
+  for(size_t i = 0; i < np; ++i) {
+    jsP[i] = p(i);
+  }
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("p", jsP);
+  result.Set("R", jsR);
+  result.Set("df", Napi::Number::New(env, m > np ? (double)(m - np) : 0.0));
+  result.Set("normr", Napi::Number::New(env, normr));
+  result.Set("rank", Napi::Number::New(env, (double)qr.rank()));
+  if(center) {
+    Napi::Float64Array jsMu = Napi::Float64Array::New(env, 2);
+    jsMu[0] = mu[0];
+    jsMu[1] = mu[1];
+    result.Set("mu", jsMu);
+  } else {
+    result.Set("mu", env.Null());
+  }
+  return result;
+}
+
+// polyfitBatch() function
+// Arguments are (x, Y, n, center) where Y holds columns of length of x one
+// after another, Vandermonde matrix is factorized once for all columns
+// --------------------
+Napi::Value NativeModule::polyfitBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "polyfitBatch expects x, Y and degree").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer, y_buffer;
+  const double* x = nullptr;
+  const double* y = nullptr;
+  size_t m, ny;
+  int n;
+  if(!readNumbers(env, info[0], "X", x_buffer, x, m) ||
+      !readNumbers(env, info[1], "Y", y_buffer, y, ny) ||
+      !readPolyDegree(env, info[2], n)) {
+    return env.Null();
+  }
+  if(m == 0 || ny % m != 0) {
+    Napi::RangeError::New(env, "Y length must be a multiple of nonzero X length").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t count = ny / m;
+  size_t np = n + 1;
+  double mu[2];
+  bool center = readPolyCenter(info, 3, x, m, mu);
+
+  MatrixXd V;
+  polyVandermonde(x, m, n, center ? mu : nullptr, V);
+  Map<const MatrixXd> Y(y, m, count);
+  ColPivHouseholderQR<MatrixXd> qr(V);
+
+  Napi::Float64Array jsP = Napi::Float64Array::New(env, np * count);
+  Napi::Float64Array jsNormr = Napi::Float64Array::New(env, count);
+  Map<MatrixXd> P(jsP.Data(), np, count);
+  P = qr.solve(Y);
+  double* normr = jsNormr.Data();
+  parallelFor(count, [&](size_t j) {
+    normr[j] = (Y.col(j) - V * P.col(j)).norm();
+  });
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("P", jsP);
+  result.Set("normr", jsNormr);
+  result.Set("df", Napi::Number::New(env, m > np ? (double)(m - np) : 0.0));
+  result.Set("rank", Napi::Number::New(env, (double)qr.rank()));
+  if(center) {
+    Napi::Float64Array jsMu = Napi::Float64Array::New(env, 2);
+    jsMu[0] = mu[0];
+    jsMu[1] = mu[1];
+    result.Set("mu", jsMu);
+  } else {
+    result.Set("mu", env.Null());
+  }
+  return result;
+}
+
+// polyval() function
+// Arguments are (p, x, mu, R, df, normr), with R, df and normr from
+// polyfit also returns standard error estimates delta
+// --------------------
+Napi::Value NativeModule::polyval(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "polyval expects coefficients and x").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> p_buffer, x_buffer, mu_buffer, r_buffer;
+  const double* p = nullptr;
+  const double* x = nullptr;
+  const double* mu = nullptr;
+  size_t np, m;
+  if(!readNumbers(env, info[0], "Coefficients", p_buffer, p, np) ||
+      !readNumbers(env, info[1], "X", x_buffer, x, m)) {
+    return env.Null();
+  }
+  bool ok = true;
+  if(info.Length() > 2 && !readPolyMu(env, info[2], mu_buffer, mu, ok) && !ok) {
+    return env.Null();
+  }
+
+  Napi::Float64Array jsY = Napi::Float64Array::New(env, m);
+  double* y = jsY.Data();
+  const size_t block = 16384;
+  parallelFor((m + block - 1) / block, [&](size_t b) {
+    size_t start = b * block;
+    polyvalKernel(p, np, x + start, (std::min)(block, m - start), mu,
+      y + start);
+  });
+  if(info.Length() < 6 || info[3].IsUndefined() || info[3].IsNull()) {
+    return jsY;
+  }
+
+  // Error estimates from triangular factor R of Vandermonde matrix
+  const double* r = nullptr;
+  if(!readMatrix(env, info[3], "R", np, np, r_buffer, r)) {
+    return env.Null();
+  }
+  if(!info[4].IsNumber() || !info[5].IsNumber()) {
+    Napi::TypeError::New(env, "Degrees of freedom and norm of residuals must be numbers").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double df = info[4].As<Napi::Number>().DoubleValue();
+  double normr = info[5].As<Napi::Number>().DoubleValue();
+  Map<const MatrixXd> R(r, np, np);
+  double scale = df > 0 ? normr / std::sqrt(df) :
+    std::numeric_limits<double>::infinity();
+
+  Napi::Float64Array jsDelta = Napi::Float64Array::New(env, m);
+  double* delta = jsDelta.Data();
+  parallelFor((m + block - 1) / block, [&](size_t b) {
+    size_t start = b * block, end = (std::min)(m, start + block);
+    VectorXd a(np);
+    for(size_t k = start; k < end; ++k) {
+      double v = mu ? (x[k] - mu[0]) / mu[1] : x[k];
+      double s = 1.0;
+      for(size_t j = np; j-- > 0;) {
+        a(j) = s;
+        s *= v;
+      }
+      R.transpose().triangularView<Lower>().solveInPlace(a);
+      delta[k] = scale * std::sqrt(1.0 + a.squaredNorm());
+    }
+  });
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("y", jsY);
+  result.Set("delta", jsDelta);
+  return result;
+}
+
+// polyvalBatch() function
+// Arguments are (P, np, x, mu) where P holds polynomials with np
+// coefficients one after another, returns values of each polynomial at x
+// one after another
+// --------------------
+Napi::Value NativeModule::polyvalBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "polyvalBatch expects coefficients, number of coefficients and x").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> p_buffer, x_buffer, mu_buffer;
+  const double* p = nullptr;
+  const double* x = nullptr;
+  const double* mu = nullptr;
+  size_t nc, m, np;
+  if(!readNumbers(env, info[0], "Coefficients", p_buffer, p, nc) ||
+      !readDimensions(info, 1, 1, "Number of coefficients", &np) ||
+      !readNumbers(env, info[2], "X", x_buffer, x, m)) {
+    return env.Null();
+  }
+  if(np == 0 || nc % np != 0) {
+    Napi::RangeError::New(env, "Coefficients length must be a multiple of number of coefficients").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  bool ok = true;
+  if(info.Length() > 3 && !readPolyMu(env, info[3], mu_buffer, mu, ok) && !ok) {
+    return env.Null();
+  }
+
+  // Centered and scaled x is shared by all polynomials
+  std::vector<double> xs;
+  if(mu) {
+    xs.resize(m);
+    for(size_t k = 0; k < m; ++k) {
+      xs[k] = (x[k] - mu[0]) / mu[1];
+    }
+    x = xs.data();
+  }
+
+  size_t count = nc / np;
+  const size_t block = 16384;
+  size_t blocks = (m + block - 1) / block;
+  Napi::Float64Array jsY = Napi::Float64Array::New(env, count * m);
+  double* y = jsY.Data();
+  parallelFor(count * blocks, [&](size_t t) {
+    size_t j = t / blocks, start = (t % blocks) * block;
+    polyvalKernel(p + j * np, np, x + start, (std::min)(block, m - start),
+      nullptr, y + j * m + start);
+  });
+  return jsY;
+}
+
+}// namespace native_module_ns
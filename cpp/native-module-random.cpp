@@ -0,0 +1,427 @@
+// JSLAB - native-module-random.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+const double RANDOM_PI = 3.14159265358979323846;
+const double RANDOM_2POW53 = 1.0 / 9007199254740992.0;
+const size_t RANDOM_BLOCK = 4096;
+const size_t RANDOM_PARALLEL = 65536;
+const uint32_t RANDOM_MAX_XOSHIRO_STREAM = 65535;
+
+// splitMix64() function
+// Advances state and returns well mixed 64-bit value, used for seeding
+// --------------------
+uint64_t splitMix64(uint64_t& state) {
+  uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+// philox4x32() function
+// Philox4x32-10 counter based generator, output depends only on counter
+// and key so any element can be generated independently
+// --------------------
+void philox4x32(const uint32_t* counter, const uint32_t* key, uint32_t* out) {
+  uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+  uint32_t k0 = key[0], k1 = key[1];
+  for(int r = 0; r < 10; ++r) {
+    uint64_t p0 = (uint64_t)0xD2511F53u * c0;
+    uint64_t p1 = (uint64_t)0xCD9E8D57u * c2;
+    uint32_t hi0 = (uint32_t)(p0 >> 32), lo0 = (uint32_t)p0;
+    uint32_t hi1 = (uint32_t)(p1 >> 32), lo1 = (uint32_t)p1;
+    c0 = hi1 ^ c1 ^ k0;
+    c1 = lo1;
+    c2 = hi0 ^ c3 ^ k1;
+    c3 = lo0;
+    k0 += 0x9E3779B9u;
+    k1 += 0xBB67AE85u;
+  }
+  out[0] = c0;
+  out[1] = c1;
+  out[2] = c2;
+  out[3] = c3;
+}
+
+// xoshiro256pp() function
+// Advances xoshiro256++ state and returns next 64-bit value
+// --------------------
+uint64_t xoshiro256pp(uint64_t* s) {
+  auto rotl = [](uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+  };
+  uint64_t result = rotl(s[0] + s[3], 23) + s[0];
+  uint64_t t = s[1] << 17;
+  s[2] ^= s[0];
+  s[3] ^= s[1];
+  s[1] ^= s[2];
+  s[0] ^= s[3];
+  s[2] ^= t;
+  s[3] = rotl(s[3], 45);
+  return result;
+}
+
+// xoshiro256ppJump() function
+// Advances xoshiro256++ state by 2^128 steps to start non-overlapping stream
+// --------------------
+void xoshiro256ppJump(uint64_t* s) {
+  static const uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL,
+    0xD5A61266F0C9392CULL, 0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+  uint64_t t[4] = {0, 0, 0, 0};
+  for(int i = 0; i < 4; ++i) {
+    for(int b = 0; b < 64; ++b) {
+      if(JUMP[i] & ((uint64_t)1 << b)) {
+        for(int k = 0; k < 4; ++k) {
+          t[k] ^= s[k];
+        }
+      }
+      xoshiro256pp(s);
+    }
+  }
+  std::copy(t, t + 4, s);
+}
+
+// randomValue() function
+// Converts random words to sample of distribution, next32 supplies further
+// words when bounded integer draw is rejected
+// --------------------
+template<typename Next32>
+double randomValue(int distribution, uint64_t a, uint64_t b, double p1,
+    double p2, Next32 next32) {
+  if(distribution == RANDOM_UNIFORM) {
+    return p1 + (p2 - p1) * ((a >> 11) * RANDOM_2POW53);
+  } else if(distribution == RANDOM_NORMAL) {
+    double u1 = ((a >> 11) + 1) * RANDOM_2POW53;
+    double u2 = (b >> 11) * RANDOM_2POW53;
+    return p1 + p2 * std::sqrt(-2.0 * std::log(u1)) *
+      std::cos(2.0 * RANDOM_PI * u2);
+  }
+
+  // Unbiased integer in [p1, p2] with multiply and reject method
+  uint64_t range = (uint64_t)((int64_t)p2 - (int64_t)p1) + 1;
+  uint64_t m = (a >> 32) * range;
+  uint32_t low = (uint32_t)m;
+  if(low < range) {
+    uint32_t threshold = (uint32_t)(((uint64_t)1 << 32) - range) % range;
+    while(low < threshold) {
+      m = (uint64_t)next32() * range;
+      low = (uint32_t)m;
+    }
+  }
+  return p1 + (double)(m >> 32);
+}
+
+// RandomGenerator()
+// Object constructor, arguments are (seed, algorithm, stream) where seed is
+// number or string and algorithm is 'philox' or 'xoshiro256pp'
+// --------------------
+RandomGenerator::RandomGenerator(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<RandomGenerator>(info) {
+  Napi::Env env = info.Env();
+  this->philox = true;
+  this->position = 0;
+  this->stream = 0;
+
+  uint64_t seed = 0;
+  if(info.Length() > 0 && info[0].IsString()) {
+    std::string text = info[0].As<Napi::String>().Utf8Value();
+    seed = 0xCBF29CE484222325ULL;
+    for(unsigned char ch : text) {
+      seed = (seed ^ ch) * 0x100000001B3ULL;
+    }
+  } else if(info.Length() > 0 && info[0].IsNumber()) {
+    double value = info[0].As<Napi::Number>().DoubleValue();
+    if(!std::isfinite(value)) {
+      Napi::RangeError::New(env, "Seed must be finite number or string").ThrowAsJavaScriptException();
+      return;
+    }
+    if(value == std::floor(value) && std::abs(value) < 9.2e18) {
+      seed = (uint64_t)(int64_t)value;
+    } else {
+      std::memcpy(&seed, &value, sizeof(seed));
+    }
+  }
+  if(info.Length() > 1 && info[1].IsString()) {
+    std::string algorithm = info[1].As<Napi::String>().Utf8Value();
+    if(algorithm == "xoshiro256pp") {
+      this->philox = false;
+    } else if(algorithm != "philox") {
+      Napi::TypeError::New(env, "Algorithm must be 'philox' or 'xoshiro256pp'").ThrowAsJavaScriptException();
+      return;
+    }
+  }
+  if(info.Length() > 2 && info[2].IsNumber()) {
+    double value = info[2].As<Napi::Number>().DoubleValue();
+    double max_stream = this->philox ? 4294967295.0 : RANDOM_MAX_XOSHIRO_STREAM;
+    if(!(value >= 0 && value <= max_stream) || value != std::floor(value)) {
+      Napi::RangeError::New(env, "Stream must be integer in supported range").ThrowAsJavaScriptException();
+      return;
+    }
+    this->stream = (uint32_t)value;
+  }
+
+  uint64_t mix = seed;
+  uint64_t key = splitMix64(mix);
+  this->key[0] = (uint32_t)key;
+  this->key[1] = (uint32_t)(key >> 32);
+  for(int k = 0; k < 4; ++k) {
+    this->state[k] = splitMix64(mix);
+  }
+  if(!this->philox) {
+    for(uint32_t s = 0; s < this->stream; ++s) {
+      xoshiro256ppJump(this->state);
+    }
+  }
+}
+
+// ~RandomGenerator()
+// Object destructor
+// --------------------
+RandomGenerator::~RandomGenerator() {
+}
+
+// Init() function
+// --------------------
+Napi::Function RandomGenerator::Init(Napi::Env env) {
+  return DefineClass(env, "RandomGenerator", {
+    InstanceMethod("rand", &RandomGenerator::RandJS),
+    InstanceMethod("randn", &RandomGenerator::RandnJS),
+    InstanceMethod("randi", &RandomGenerator::RandiJS),
+    InstanceMethod("fill", &RandomGenerator::FillJS),
+    InstanceMethod("next", &RandomGenerator::NextJS),
+    InstanceMethod("getAlgorithm", &RandomGenerator::GetAlgorithmJS)
+  });
+}
+
+// generate() function
+// Fills n samples, Philox samples depend only on their position so blocks
+// are filled in parallel with same result for any number of threads
+// --------------------
+void RandomGenerator::generate(int distribution, double p1, double p2,
+    size_t n, double* y, int32_t* yi) {
+  auto store = [&](size_t i, double value) {
+    if(yi) {
+      yi[i] = (int32_t)value;
+    } else {
+      y[i] = value;
+    }
+  };
+
+  if(!this->philox) {
+    uint64_t* s = this->state;
+    auto next32 = [s]() {
+      return (uint32_t)(xoshiro256pp(s) >> 32);
+    };
+    for(size_t i = 0; i < n; ++i) {
+      uint64_t a = xoshiro256pp(s);
+      uint64_t b = distribution == RANDOM_NORMAL ? xoshiro256pp(s) : 0;
+      store(i, randomValue(distribution, a, b, p1, p2, next32));
+    }
+    return;
+  }
+
+  // Element at position p uses counter (p, stream, 0), rejected integer
+  // draws continue with counters (p, stream, 1), (p, stream, 2), ...
+  uint64_t start = this->position;
+  auto fillBlock = [&](size_t k) {
+    size_t lo = k * RANDOM_BLOCK;
+    size_t hi = (std::min)(n, lo + RANDOM_BLOCK);
+    for(size_t i = lo; i < hi; ++i) {
+      uint64_t p = start + i;
+      uint32_t counter[4] = {(uint32_t)p, (uint32_t)(p >> 32),
+        this->stream, 0};
+      uint32_t out[4];
+      philox4x32(counter, this->key, out);
+      uint64_t a = ((uint64_t)out[0] << 32) | out[1];
+      uint64_t b = ((uint64_t)out[2] << 32) | out[3];
+      int word = 1;
+      auto next32 = [&]() {
+        if(word == 4) {
+          counter[3]++;
+          philox4x32(counter, this->key, out);
+          word = 0;
+        }
+        return out[word++];
+      };
+      store(i, randomValue(distribution, a, b, p1, p2, next32));
+    }
+  };
+  size_t blocks = (n + RANDOM_BLOCK - 1) / RANDOM_BLOCK;
+  if(n >= RANDOM_PARALLEL) {
+    parallelFor(blocks, fillBlock);
+  } else {
+    for(size_t k = 0; k < blocks; ++k) {
+      fillBlock(k);
+    }
+  }
+  this->position += n;
+}
+
+// readDistribution() function
+// Reads distribution parameters starting at info[first], integer bounds
+// must fit into Int32Array
+// --------------------
+bool readDistribution(const Napi::CallbackInfo& info, size_t first,
+    int distribution, double& p1, double& p2) {
+  Napi::Env env = info.Env();
+  p1 = distribution == RANDOM_INTEGER ? 1 : 0;
+  p2 = 1;
+  if(info.Length() > first && info[first].IsNumber()) {
+    p1 = info[first].As<Napi::Number>().DoubleValue();
+  }
+  if(info.Length() > first + 1 && info[first + 1].IsNumber()) {
+    p2 = info[first + 1].As<Napi::Number>().DoubleValue();
+  } else if(distribution == RANDOM_INTEGER) {
+    // Single bound gives integers in [1, p1] as in MATLAB randi
+    p2 = p1;
+    p1 = 1;
+  }
+  if(distribution == RANDOM_INTEGER) {
+    if(p1 != std::floor(p1) || p2 != std::floor(p2) || p1 > p2 ||
+        p1 < -2147483648.0 || p2 > 2147483647.0) {
+      Napi::RangeError::New(env, "Integer bounds must be 32-bit integers with lower bound not greater than upper bound").ThrowAsJavaScriptException();
+      return false;
+    }
+  } else if(!std::isfinite(p1) || !std::isfinite(p2)) {
+    Napi::RangeError::New(env, "Distribution parameters must be finite").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// RandJS() function
+// Arguments are (n, a, b), returns n uniform samples in [a, b)
+// --------------------
+Napi::Value RandomGenerator::RandJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t n;
+  double p1, p2;
+  if(!readDimensions(info, 0, 1, "Number of samples", &n) ||
+      !readDistribution(info, 1, RANDOM_UNIFORM, p1, p2)) {
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n);
+  this->generate(RANDOM_UNIFORM, p1, p2, n, jsResult.Data(), nullptr);
+  return jsResult;
+}
+
+// RandnJS() function
+// Arguments are (n, mu, sigma), returns n normal samples
+// --------------------
+Napi::Value RandomGenerator::RandnJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t n;
+  double p1, p2;
+  if(!readDimensions(info, 0, 1, "Number of samples", &n) ||
+      !readDistribution(info, 1, RANDOM_NORMAL, p1, p2)) {
+    return env.Null();
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n);
+  this->generate(RANDOM_NORMAL, p1, p2, n, jsResult.Data(), nullptr);
+  return jsResult;
+}
+
+// RandiJS() function
+// Arguments are (n, lo, hi), returns n integers in [lo, hi] as Int32Array
+// --------------------
+Napi::Value RandomGenerator::RandiJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t n;
+  double p1, p2;
+  if(!readDimensions(info, 0, 1, "Number of samples", &n) ||
+      !readDistribution(info, 1, RANDOM_INTEGER, p1, p2)) {
+    return env.Null();
+  }
+  Napi::Int32Array jsResult = Napi::Int32Array::New(env, n);
+  this->generate(RANDOM_INTEGER, p1, p2, n, nullptr, jsResult.Data());
+  return jsResult;
+}
+
+// FillJS() function
+// Arguments are (array, distribution, a, b), fills Float64Array or
+// Int32Array in place with 'uniform', 'normal' or 'integer' samples
+// --------------------
+Napi::Value RandomGenerator::FillJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsTypedArray()) {
+    Napi::TypeError::New(env, "fill expects Float64Array or Int32Array").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  Napi::TypedArray array = info[0].As<Napi::TypedArray>();
+  napi_typedarray_type type = array.TypedArrayType();
+  if(type != napi_float64_array && type != napi_int32_array) {
+    Napi::TypeError::New(env, "fill expects Float64Array or Int32Array").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  int distribution = type == napi_int32_array ? RANDOM_INTEGER : RANDOM_UNIFORM;
+  if(info.Length() > 1 && info[1].IsString()) {
+    std::string name = info[1].As<Napi::String>().Utf8Value();
+    if(name == "uniform") {
+      distribution = RANDOM_UNIFORM;
+    } else if(name == "normal") {
+      distribution = RANDOM_NORMAL;
+    } else if(name == "integer") {
+      distribution = RANDOM_INTEGER;
+    } else {
+      Napi::TypeError::New(env, "Distribution must be 'uniform', 'normal' or 'integer'").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+  if(type == napi_int32_array && distribution != RANDOM_INTEGER) {
+    Napi::TypeError::New(env, "Int32Array can be filled only with 'integer' distribution").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  double p1, p2;
+  if(!readDistribution(info, 2, distribution, p1, p2)) {
+    return env.Null();
+  }
+
+  size_t n = array.ElementLength();
+  if(type == napi_int32_array) {
+    this->generate(distribution, p1, p2, n, nullptr,
+      info[0].As<Napi::Int32Array>().Data());
+  } else {
+    this->generate(distribution, p1, p2, n,
+      info[0].As<Napi::Float64Array>().Data(), nullptr);
+  }
+  return info[0];
+}
+
+// NextJS() function
+// Returns single uniform sample in [0, 1)
+// --------------------
+Napi::Value RandomGenerator::NextJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  double value;
+  this->generate(RANDOM_UNIFORM, 0, 1, 1, &value, nullptr);
+  return Napi::Number::New(env, value);
+}
+
+// GetAlgorithmJS() function
+// --------------------
+Napi::Value RandomGenerator::GetAlgorithmJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  return Napi::String::New(env, this->philox ? "philox" : "xoshiro256pp");
+}
+
+// rng() function
+// Arguments are (seed, algorithm, stream), returns native random generator
+// --------------------
+Napi::Value NativeModule::rng(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Value seed = info.Length() > 0 ? info[0] : env.Undefined();
+  Napi::Value algorithm = info.Length() > 1 && info[1].IsString() ?
+    info[1] : Napi::String::New(env, "philox");
+  Napi::Value stream = info.Length() > 2 ? info[2] : env.Undefined();
+  return env.GetInstanceData<AddonData>()->randomGenerator.New(
+    {seed, algorithm, stream});
+}
+
+}// namespace native_module_ns
@@ -0,0 +1,569 @@
+// JSLAB - native-module-signal.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+typedef std::complex<double> cd;
+
+const double SIGNAL_PI = 3.14159265358979323846;
+
+// Shorter operand length and product of lengths up to which convolution
+// is computed directly
+const size_t CONV_DIRECT_LENGTH = 64;
+const double CONV_DIRECT_WORK = 1e5;
+
+// normalizeFilter() function
+// Pads b and a with zeros to common length and divides them by a[0]
+// --------------------
+bool normalizeFilter(const double* b, size_t nb, const double* a, size_t na,
+    std::vector<double>& bn, std::vector<double>& an) {
+  if(na == 0 || nb == 0 || a[0] == 0) {
+    return false;
+  }
+  size_t L = (std::max)(nb, na);
+  bn.assign(L, 0.0);
+  an.assign(L, 0.0);
+  for(size_t i = 0; i < nb; ++i) {
+    bn[i] = b[i] / a[0];
+  }
+  for(size_t i = 0; i < na; ++i) {
+    an[i] = a[i] / a[0];
+  }
+  return true;
+}
+
+// filterKernel() function
+// Direct form II transposed over normalized coefficients of length L,
+// state z of length L-1 is carried in and out
+// --------------------
+void filterKernel(const double* b, const double* a, size_t L,
+    const double* x, size_t N, double* z, double* y) {
+  size_t order = L - 1;
+  for(size_t k = 0; k < N; ++k) {
+    double xk = x[k];
+    double yk = b[0] * xk + (order > 0 ? z[0] : 0.0);
+    for(size_t i = 1; i < order; ++i) {
+      z[i - 1] = b[i] * xk + z[i] - a[i] * yk;
+    }
+    if(order > 0) {
+      z[order - 1] = b[order] * xk - a[order] * yk;
+    }
+    y[k] = yk;
+  }
+}
+
+// filtfiltInitial() function
+// State of filter in steady state for unit step input
+// --------------------
+std::vector<double> filtfiltInitial(const std::vector<double>& b,
+    const std::vector<double>& a) {
+  size_t order = b.size() - 1;
+  std::vector<double> zi(order, 0.0);
+  if(order == 0) {
+    return zi;
+  }
+  MatrixXd M = MatrixXd::Identity(order, order);
+  VectorXd r(order);
+  for(size_t i = 0; i < order; ++i) {
+    M(i, 0) += a[i + 1];
+    if(i + 1 < order) {
+      M(i, i + 1) -= 1.0;
+    }
+    r(i) = b[i + 1] - b[0] * a[i + 1];
+  }
+  VectorXd s = M.colPivHouseholderQr().solve(r);
+  for(size_t i = 0; i < order; ++i) {
+    zi[i] = s(i);
+  }
+  return zi;
+}
+
+// filtfiltKernel() function
+// Zero-phase forward and reverse filtering of signal extended by odd
+// reflection of 3*order samples at both ends, requires N > 3*order
+// --------------------
+void filtfiltKernel(const std::vector<double>& b, const std::vector<double>& a,
+    const std::vector<double>& zi, const double* x, size_t N, double* y) {
+  size_t L = b.size(), order = L - 1, nfact = 3 * order;
+  size_t Ne = N + 2 * nfact;
+  std::vector<double> xt(Ne), yt(Ne), z(order);
+  for(size_t i = 0; i < nfact; ++i) {
+    xt[i] = 2 * x[0] - x[nfact - i];
+    xt[nfact + N + i] = 2 * x[N - 1] - x[N - 2 - i];
+  }
+  std::copy(x, x + N, xt.begin() + nfact);
+
+  for(size_t i = 0; i < order; ++i) {
+    z[i] = zi[i] * xt[0];
+  }
+  filterKernel(b.data(), a.data(), L, xt.data(), Ne, z.data(), yt.data());
+  std::reverse(yt.begin(), yt.end());
+  for(size_t i = 0; i < order; ++i) {
+    z[i] = zi[i] * yt[0];
+  }
+  filterKernel(b.data(), a.data(), L, yt.data(), Ne, z.data(), xt.data());
+  for(size_t k = 0; k < N; ++k) {
+    y[k] = xt[Ne - 1 - nfact - k];
+  }
+}
+
+// convFastSize() function
+// Smallest even size of form 2^a 3^b 5^c not smaller than n
+// --------------------
+size_t convFastSize(size_t n) {
+  size_t best = 2;
+  while(best < n) {
+    best <<= 1;
+  }
+  for(size_t p5 = 1; p5 < best; p5 *= 5) {
+    for(size_t p35 = p5; p35 < best; p35 *= 3) {
+      size_t s = p35 * 2;
+      while(s < n) {
+        s <<= 1;
+      }
+      best = (std::min)(best, s);
+    }
+  }
+  return best;
+}
+
+// convColumns() function
+// Full convolution of each of channels columns of u (length n) with v
+// (length m), FFT based for long operands
+// --------------------
+void convColumns(const double* u, size_t n, size_t channels, const double* v,
+    size_t m, double* out) {
+  size_t L = n + m - 1;
+  if((std::min)(n, m) <= CONV_DIRECT_LENGTH ||
+      (double)n * (double)m <= CONV_DIRECT_WORK) {
+    parallelFor(channels, [&](size_t c) {
+      const double* uc = u + c * n;
+      double* oc = out + c * L;
+      std::fill(oc, oc + L, 0.0);
+      for(size_t i = 0; i < n; ++i) {
+        double ui = uc[i];
+        for(size_t j = 0; j < m; ++j) {
+          oc[i + j] += ui * v[j];
+        }
+      }
+    });
+    return;
+  }
+
+  size_t nfft = convFastSize(L), nh = nfft / 2 + 1;
+  std::vector<double> buffer(nfft, 0.0);
+  std::copy(v, v + m, buffer.begin());
+  std::vector<cd> V(nh);
+  rfftKernel(buffer.data(), nfft, V.data(), channels == 1);
+  parallelFor(channels, [&](size_t c) {
+    std::vector<double> a(nfft, 0.0), r(nfft);
+    std::copy(u + c * n, u + (c + 1) * n, a.begin());
+    std::vector<cd> U(nh);
+    rfftKernel(a.data(), nfft, U.data(), channels == 1);
+    for(size_t k = 0; k < nh; ++k) {
+      U[k] *= V[k];
+    }
+    irfftKernel(U.data(), nh, nfft, r.data(), channels == 1);
+    std::copy(r.begin(), r.begin() + L, out + c * L);
+  });
+}
+
+// besselI0() function
+// Modified Bessel function of first kind and order zero
+// --------------------
+double besselI0(double x) {
+  double sum = 1.0, term = 1.0, q = x * x / 4.0;
+  for(int k = 1; k < 500; ++k) {
+    term *= q / ((double)k * k);
+    sum += term;
+    if(term < 1e-17 * sum) {
+      break;
+    }
+  }
+  return sum;
+}
+
+// lowpassFIR() function
+// Windowed sinc lowpass of length 2*half+1 with cutoff fc in cycles per
+// sample, Kaiser window for beta > 0 and Hamming window otherwise
+// --------------------
+std::vector<double> lowpassFIR(size_t half, double fc, double beta,
+    double gain) {
+  size_t len = 2 * half + 1;
+  std::vector<double> h(len);
+  double i0 = besselI0(beta);
+  for(size_t j = 0; j < len; ++j) {
+    double t = (double)j - (double)half;
+    double s = t == 0 ? 2 * fc : std::sin(2 * SIGNAL_PI * fc * t) / (SIGNAL_PI * t);
+    double w;
+    if(half == 0) {
+      w = 1.0;
+    } else if(beta > 0) {
+      double r = t / (double)half;
+      w = besselI0(beta * std::sqrt((std::max)(0.0, 1 - r * r))) / i0;
+    } else {
+      w = 0.54 - 0.46 * std::cos(2 * SIGNAL_PI * (double)j / (double)(len - 1));
+    }
+    h[j] = gain * s * w;
+  }
+  if(beta <= 0) {
+    // Unit gain at zero frequency as in fir1
+    double sum = 0;
+    for(double v : h) {
+      sum += v;
+    }
+    for(double& v : h) {
+      v *= gain / sum;
+    }
+  }
+  return h;
+}
+
+// readChannels() function
+// Reads column-major data with given number of channels
+// --------------------
+bool readChannels(const Napi::CallbackInfo& info, size_t index,
+    size_t channels_index, std::vector<double>& buffer, const double*& x,
+    size_t& N, size_t& channels) {
+  Napi::Env env = info.Env();
+  size_t n;
+  if(!readNumbers(env, info[index], "Data", buffer, x, n)) {
+    return false;
+  }
+  channels = 1;
+  if(info.Length() > channels_index && !info[channels_index].IsUndefined() &&
+      !info[channels_index].IsNull() &&
+      !readDimensions(info, channels_index, 1, "Number of channels", &channels)) {
+    return false;
+  }
+  if(channels == 0 || n % channels != 0) {
+    Napi::RangeError::New(env, "Data length must be a multiple of number of channels").ThrowAsJavaScriptException();
+    return false;
+  }
+  N = n / channels;
+  return true;
+}
+
+// readFilter() function
+// Reads and normalizes coefficients b and a
+// --------------------
+bool readFilter(const Napi::CallbackInfo& info, std::vector<double>& bn,
+    std::vector<double>& an) {
+  Napi::Env env = info.Env();
+  std::vector<double> b_buffer, a_buffer;
+  const double* b = nullptr;
+  const double* a = nullptr;
+  size_t nb, na;
+  if(!readNumbers(env, info[0], "Numerator", b_buffer, b, nb) ||
+      !readNumbers(env, info[1], "Denominator", a_buffer, a, na)) {
+    return false;
+  }
+  if(!normalizeFilter(b, nb, a, na, bn, an)) {
+    Napi::RangeError::New(env, "Coefficients must be nonempty with nonzero a(1)").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// filter() function
+// Arguments are (b, a, X, channels, zi) for X with channels columns and zi
+// with max(length(a), length(b))-1 rows, returns output y and final state zf
+// --------------------
+Napi::Value NativeModule::filter(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "filter expects b, a and x").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> bn, an, x_buffer, z_buffer;
+  const double* x = nullptr;
+  const double* zi = nullptr;
+  size_t N, channels;
+  if(!readFilter(info, bn, an) ||
+      !readChannels(info, 2, 3, x_buffer, x, N, channels)) {
+    return env.Null();
+  }
+  size_t order = bn.size() - 1;
+  if(info.Length() > 4 && !info[4].IsUndefined() && !info[4].IsNull() &&
+      !readMatrix(env, info[4], "Initial conditions", order, channels,
+        z_buffer, zi)) {
+    return env.Null();
+  }
+
+  Napi::Float64Array jsY = Napi::Float64Array::New(env, N * channels);
+  Napi::Float64Array jsZ = Napi::Float64Array::New(env, order * channels);
+  double* y = jsY.Data();
+  double* z = jsZ.Data();
+  if(zi) {
+    std::copy(zi, zi + order * channels, z);
+  } else {
+    std::fill(z, z + order * channels, 0.0);
+  }
+  parallelFor(channels, [&](size_t c) {
+    filterKernel(bn.data(), an.data(), bn.size(), x + c * N, N,
+      z + c * order, y + c * N);
+  });
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("y", jsY);
+  result.Set("zf", jsZ);
+  return result;
+}
+
+// filtfilt() function
+// Arguments are (b, a, X, channels), zero-phase filtering of each channel
+// --------------------
+Napi::Value NativeModule::filtfilt(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "filtfilt expects b, a and x").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> bn, an, x_buffer;
+  const double* x = nullptr;
+  size_t N, channels;
+  if(!readFilter(info, bn, an) ||
+      !readChannels(info, 2, 3, x_buffer, x, N, channels)) {
+    return env.Null();
+  }
+  if(N <= 3 * (bn.size() - 1) || N < 2) {
+    Napi::RangeError::New(env, "Data length must be greater than 3 times filter order").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  std::vector<double> zi = filtfiltInitial(bn, an);
+  Napi::Float64Array jsY = Napi::Float64Array::New(env, N * channels);
+  double* y = jsY.Data();
+  parallelFor(channels, [&](size_t c) {
+    filtfiltKernel(bn, an, zi, x + c * N, N, y + c * N);
+  });
+  return jsY;
+}
+
+// conv() function
+// Arguments are (U, v, shape, channels), convolves each channel of U with
+// v, shape is 'full', 'same' or 'valid'
+// --------------------
+Napi::Value NativeModule::conv(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "conv expects u and v").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> u_buffer, v_buffer;
+  const double* u = nullptr;
+  const double* v = nullptr;
+  size_t n, m, channels;
+  if(!readChannels(info, 0, 3, u_buffer, u, n, channels) ||
+      !readNumbers(env, info[1], "Kernel", v_buffer, v, m)) {
+    return env.Null();
+  }
+  std::string shape = "full";
+  if(info.Length() > 2 && info[2].IsString()) {
+    shape = info[2].As<Napi::String>().Utf8Value();
+  }
+  if(shape != "full" && shape != "same" && shape != "valid") {
+    Napi::TypeError::New(env, "Shape must be 'full', 'same' or 'valid'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(n == 0 || m == 0) {
+    return Napi::Float64Array::New(env, 0);
+  }
+
+  size_t L = n + m - 1;
+  std::vector<double> full(L * channels);
+  convColumns(u, n, channels, v, m, full.data());
+  size_t start = 0, len = L;
+  if(shape == "same") {
+    start = m / 2;
+    len = n;
+  } else if(shape == "valid") {
+    start = m - 1;
+    len = n >= m ? n - m + 1 : 0;
+  }
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, len * channels);
+  for(size_t c = 0; c < channels; ++c) {
+    std::copy(full.begin() + c * L + start, full.begin() + c * L + start + len,
+      jsResult.Data() + c * len);
+  }
+  return jsResult;
+}
+
+// deconv() function
+// Arguments are (B, a, channels), polynomial division of each channel of B
+// by a, returns quotient q and remainder r
+// --------------------
+Napi::Value NativeModule::deconv(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "deconv expects b and a").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> b_buffer, a_buffer;
+  const double* b = nullptr;
+  const double* a = nullptr;
+  size_t nb, na, channels;
+  if(!readChannels(info, 0, 2, b_buffer, b, nb, channels) ||
+      !readNumbers(env, info[1], "Divisor", a_buffer, a, na)) {
+    return env.Null();
+  }
+  if(na == 0 || a[0] == 0) {
+    Napi::RangeError::New(env, "First coefficient of divisor must be nonzero").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  size_t nq = nb >= na ? nb - na + 1 : 0;
+  Napi::Float64Array jsQ = Napi::Float64Array::New(env, nq * channels);
+  Napi::Float64Array jsR = Napi::Float64Array::New(env, nb * channels);
+  double* q = jsQ.Data();
+  double* r = jsR.Data();
+  parallelFor(channels, [&](size_t c) {
+    const double* bc = b + c * nb;
+    double* qc = q + c * nq;
+    double* rc = r + c * nb;
+    std::copy(bc, bc + nb, rc);
+    // Long division, remainder keeps length of b with leading zeros
+    for(size_t k = 0; k < nq; ++k) {
+      double f = rc[k] / a[0];
+      qc[k] = f;
+      for(size_t j = 0; j < na; ++j) {
+        rc[k + j] -= f * a[j];
+      }
+      rc[k] = 0.0;
+    }
+  });
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("q", jsQ);
+  result.Set("r", jsR);
+  return result;
+}
+
+// decimate() function
+// Arguments are (X, r, channels), zero-phase FIR lowpass of order 30 with
+// cutoff 1/r followed by keeping every r-th sample so last one is kept
+// --------------------
+Napi::Value NativeModule::decimate(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "decimate expects x and r").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t N, channels, r;
+  if(!readChannels(info, 0, 2, x_buffer, x, N, channels) ||
+      !readDimensions(info, 1, 1, "Decimation factor", &r)) {
+    return env.Null();
+  }
+  if(r == 0) {
+    Napi::RangeError::New(env, "Decimation factor must be positive").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  const size_t half = 15;
+  if(r > 1 && N <= 6 * half) {
+    Napi::RangeError::New(env, "Data length must be greater than 90 samples").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  size_t Ny = (N + r - 1) / r;
+  size_t start = r - 1 - (r * Ny - N);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, Ny * channels);
+  double* y = jsResult.Data();
+  if(r == 1) {
+    std::copy(x, x + N * channels, y);
+    return jsResult;
+  }
+  std::vector<double> h = lowpassFIR(half, 0.5 / (double)r, 0.0, 1.0);
+  std::vector<double> a(h.size(), 0.0);
+  a[0] = 1.0;
+  std::vector<double> zi = filtfiltInitial(h, a);
+  parallelFor(channels, [&](size_t c) {
+    std::vector<double> yf(N);
+    filtfiltKernel(h, a, zi, x + c * N, N, yf.data());
+    for(size_t k = 0; k < Ny; ++k) {
+      y[c * Ny + k] = yf[start + k * r];
+    }
+  });
+  return jsResult;
+}
+
+// resample() function
+// Arguments are (X, p, q, channels), changes sample rate by p/q with
+// polyphase evaluation of Kaiser windowed lowpass, output has ceil(N*p/q)
+// samples
+// --------------------
+Napi::Value NativeModule::resample(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "resample expects x, p and q").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t N, channels, pq[2];
+  if(!readChannels(info, 0, 3, x_buffer, x, N, channels) ||
+      !readDimensions(info, 1, 2, "Resampling factors", pq)) {
+    return env.Null();
+  }
+  size_t p = pq[0], q = pq[1];
+  if(p == 0 || q == 0) {
+    Napi::RangeError::New(env, "Resampling factors must be positive").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t g = std::gcd(p, q);
+  p /= g;
+  q /= g;
+
+  size_t Ny = (N * p + q - 1) / q;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, Ny * channels);
+  double* y = jsResult.Data();
+  if(p == 1 && q == 1) {
+    std::copy(x, x + N * channels, y);
+    return jsResult;
+  }
+  size_t half = 10 * (std::max)(p, q);
+  std::vector<double> h = lowpassFIR(half, 0.5 / (double)(std::max)(p, q),
+    5.0, (double)p);
+  size_t len = h.size();
+
+  // Each polyphase branch is scaled to unit gain at zero frequency
+  for(size_t r = 0; r < p; ++r) {
+    double sum = 0;
+    for(size_t j = r; j < len; j += p) {
+      sum += h[j];
+    }
+    for(size_t j = r; j < len; j += p) {
+      h[j] /= sum;
+    }
+  }
+  parallelFor(channels, [&](size_t c) {
+    const double* xc = x + c * N;
+    double* yc = y + c * Ny;
+    for(size_t k = 0; k < Ny; ++k) {
+      size_t t = k * q + half;
+      double sum = 0;
+      for(size_t j = t % p; j < len && j <= t; j += p) {
+        size_t i = (t - j) / p;
+        if(i < N) {
+          sum += h[j] * xc[i];
+        }
+      }
+      yc[k] = sum;
+    }
+  });
+  return jsResult;
+}
+
+}// namespace native_module_ns
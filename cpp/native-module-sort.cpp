@@ -0,0 +1,372 @@
+// JSLAB - native-module-sort.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+const size_t SORT_RADIX_BITS = 11;
+const size_t SORT_RADIX_SIZE = (size_t)1 << SORT_RADIX_BITS;
+const size_t SORT_RADIX_PASSES = 6;
+const size_t SORT_SMALL = 64;
+const size_t SORT_PARALLEL = (size_t)1 << 18;
+
+// sortKey() function
+// Maps double to unsigned key with same ordering, signed zeros are equal and
+// NaN is placed after infinity, descending order complements key
+// --------------------
+uint64_t sortKey(double v, bool descending) {
+  uint64_t u = ~(uint64_t)0;
+  if(!std::isnan(v)) {
+    if(v == 0) {
+      v = 0.0;
+    }
+    std::memcpy(&u, &v, sizeof(u));
+    u = (u >> 63) ? ~u : (u | ((uint64_t)1 << 63));
+  }
+  return descending ? ~u : u;
+}
+
+// radixSortKernel() function
+// Stable LSD radix sort of keys with attached indices, passes where all
+// keys share the same digit are skipped
+// --------------------
+void radixSortKernel(uint64_t* keys, uint32_t* idx, size_t n) {
+  if(n < SORT_SMALL) {
+    for(size_t i = 1; i < n; ++i) {
+      uint64_t k = keys[i];
+      uint32_t id = idx[i];
+      size_t j = i;
+      for(; j > 0 && keys[j - 1] > k; --j) {
+        keys[j] = keys[j - 1];
+        idx[j] = idx[j - 1];
+      }
+      keys[j] = k;
+      idx[j] = id;
+    }
+    return;
+  }
+
+  std::vector<size_t> counts(SORT_RADIX_PASSES * SORT_RADIX_SIZE, 0);
+  for(size_t i = 0; i < n; ++i) {
+    uint64_t k = keys[i];
+    for(size_t p = 0; p < SORT_RADIX_PASSES; ++p) {
+      counts[p * SORT_RADIX_SIZE +
+        ((k >> (p * SORT_RADIX_BITS)) & (SORT_RADIX_SIZE - 1))]++;
+    }
+  }
+
+  std::vector<uint64_t> keys_tmp(n);
+  std::vector<uint32_t> idx_tmp(n);
+  uint64_t* src_keys = keys;
+  uint32_t* src_idx = idx;
+  uint64_t* dst_keys = keys_tmp.data();
+  uint32_t* dst_idx = idx_tmp.data();
+  for(size_t p = 0; p < SORT_RADIX_PASSES; ++p) {
+    size_t* count = counts.data() + p * SORT_RADIX_SIZE;
+    size_t shift = p * SORT_RADIX_BITS;
+    if(count[(src_keys[0] >> shift) & (SORT_RADIX_SIZE - 1)] == n) {
+      continue;
+    }
+    size_t offset = 0;
+    for(size_t d = 0; d < SORT_RADIX_SIZE; ++d) {
+      size_t c = count[d];
+      count[d] = offset;
+      offset += c;
+    }
+    for(size_t i = 0; i < n; ++i) {
+      size_t pos = count[(src_keys[i] >> shift) & (SORT_RADIX_SIZE - 1)]++;
+      dst_keys[pos] = src_keys[i];
+      dst_idx[pos] = src_idx[i];
+    }
+    std::swap(src_keys, dst_keys);
+    std::swap(src_idx, dst_idx);
+  }
+  if(src_keys != keys) {
+    std::copy(src_keys, src_keys + n, keys);
+    std::copy(src_idx, src_idx + n, idx);
+  }
+}
+
+// sortIndexKernel() function
+// Stable sort of keys with attached indices, large inputs are split into
+// chunks sorted in parallel and merged pairwise
+// --------------------
+void sortIndexKernel(uint64_t* keys, uint32_t* idx, size_t n, bool parallel) {
+  size_t threads = (std::max)(1u, std::thread::hardware_concurrency());
+  if(!parallel || n < SORT_PARALLEL || threads < 2) {
+    radixSortKernel(keys, idx, n);
+    return;
+  }
+
+  size_t chunks = 1;
+  while(chunks < threads) {
+    chunks *= 2;
+  }
+  size_t width = (n + chunks - 1) / chunks;
+  parallelFor(chunks, [&](size_t c) {
+    size_t lo = (std::min)(n, c * width);
+    size_t hi = (std::min)(n, lo + width);
+    radixSortKernel(keys + lo, idx + lo, hi - lo);
+  });
+
+  std::vector<uint64_t> keys_tmp(n);
+  std::vector<uint32_t> idx_tmp(n);
+  uint64_t* src_keys = keys;
+  uint32_t* src_idx = idx;
+  uint64_t* dst_keys = keys_tmp.data();
+  uint32_t* dst_idx = idx_tmp.data();
+  for(; width < n; width *= 2) {
+    size_t pairs = (n + 2 * width - 1) / (2 * width);
+    parallelFor(pairs, [&](size_t k) {
+      size_t lo = k * 2 * width;
+      size_t mid = (std::min)(n, lo + width);
+      size_t hi = (std::min)(n, lo + 2 * width);
+      size_t i = lo, j = mid, o = lo;
+      while(i < mid && j < hi) {
+        if(src_keys[j] < src_keys[i]) {
+          dst_keys[o] = src_keys[j];
+          dst_idx[o++] = src_idx[j++];
+        } else {
+          dst_keys[o] = src_keys[i];
+          dst_idx[o++] = src_idx[i++];
+        }
+      }
+      for(; i < mid; ++i, ++o) {
+        dst_keys[o] = src_keys[i];
+        dst_idx[o] = src_idx[i];
+      }
+      for(; j < hi; ++j, ++o) {
+        dst_keys[o] = src_keys[j];
+        dst_idx[o] = src_idx[j];
+      }
+    });
+    std::swap(src_keys, dst_keys);
+    std::swap(src_idx, dst_idx);
+  }
+  if(src_keys != keys) {
+    std::copy(src_keys, src_keys + n, keys);
+    std::copy(src_idx, src_idx + n, idx);
+  }
+}
+
+// argsortKernel() function
+// Stable permutation sorting rows of column-major keys, keys are applied
+// from last to first so that first key has highest priority
+// --------------------
+void argsortKernel(const double* K, size_t n, size_t nkeys,
+    const std::vector<bool>& descending, uint32_t* perm) {
+  std::vector<uint64_t> keys(n);
+  std::vector<uint32_t> order(n);
+  std::vector<uint32_t> next(n);
+  for(size_t i = 0; i < n; ++i) {
+    perm[i] = (uint32_t)i;
+  }
+  for(size_t j = nkeys; j-- > 0;) {
+    const double* column = K + j * n;
+    for(size_t i = 0; i < n; ++i) {
+      keys[i] = sortKey(column[perm[i]], descending[j]);
+      order[i] = (uint32_t)i;
+    }
+    sortIndexKernel(keys.data(), order.data(), n, true);
+    for(size_t i = 0; i < n; ++i) {
+      next[i] = perm[order[i]];
+    }
+    std::copy(next.begin(), next.end(), perm);
+  }
+}
+
+// prctileKernel() function
+// Percentiles of non NaN values with nth_element selection, sample i of
+// sorted data is at percentile 100*(i+0.5)/n as in MATLAB prctile
+// --------------------
+void prctileKernel(const double* x, size_t N, const double* p, size_t np,
+    double* y) {
+  std::vector<double> v;
+  v.reserve(N);
+  for(size_t i = 0; i < N; ++i) {
+    if(!std::isnan(x[i])) {
+      v.push_back(x[i]);
+    }
+  }
+  size_t n = v.size();
+  std::vector<size_t> order(np);
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+    return p[a] < p[b];
+  });
+
+  // Selections are done with increasing rank so that each one only
+  // partitions values not smaller than previous one
+  size_t begin = 0;
+  for(size_t k : order) {
+    if(n == 0) {
+      y[k] = std::numeric_limits<double>::quiet_NaN();
+      continue;
+    }
+    double pos = n * p[k] / 100.0 - 0.5;
+    pos = (std::min)((std::max)(pos, 0.0), (double)(n - 1));
+    size_t lo = (size_t)std::floor(pos);
+    double frac = pos - lo;
+    std::nth_element(v.begin() + begin, v.begin() + lo, v.end());
+    begin = lo;
+    double value = v[lo];
+    if(frac > 0 && lo + 1 < n) {
+      double upper = *std::min_element(v.begin() + lo + 1, v.end());
+      value += frac * (upper - value);
+    }
+    y[k] = value;
+  }
+}
+
+// sort() function
+// Arguments are (X, channels, descending), each channel is sorted stably
+// with NaN last in ascending and first in descending order
+// --------------------
+Napi::Value NativeModule::sort(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "sort expects data and channels").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t n, channels;
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, n) ||
+      !readDimensions(info, 1, 1, "Number of channels", &channels)) {
+    return env.Null();
+  }
+  if(channels == 0 || n % channels != 0) {
+    Napi::RangeError::New(env, "Data length must be a multiple of number of channels").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(n / channels > 0xFFFFFFFFu) {
+    Napi::RangeError::New(env, "Data is too large to sort").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  bool descending = info.Length() > 2 && info[2].ToBoolean();
+
+  size_t N = n / channels;
+  Napi::Float64Array jsValues = Napi::Float64Array::New(env, n);
+  Napi::Uint32Array jsIndex = Napi::Uint32Array::New(env, n);
+  double* y = jsValues.Data();
+  uint32_t* index = jsIndex.Data();
+  auto sortChannel = [&](size_t c, bool parallel) {
+    const double* xc = x + c * N;
+    uint32_t* ic = index + c * N;
+    std::vector<uint64_t> keys(N);
+    for(size_t i = 0; i < N; ++i) {
+      keys[i] = sortKey(xc[i], descending);
+      ic[i] = (uint32_t)i;
+    }
+    sortIndexKernel(keys.data(), ic, N, parallel);
+    for(size_t i = 0; i < N; ++i) {
+      y[c * N + i] = xc[ic[i]];
+    }
+  };
+  if(channels == 1) {
+    sortChannel(0, true);
+  } else {
+    parallelFor(channels, [&](size_t c) {
+      sortChannel(c, false);
+    });
+  }
+
+  Napi::Object result = Napi::Object::New(env);
+  result.Set("y", jsValues);
+  result.Set("index", jsIndex);
+  return result;
+}
+
+// argsort() function
+// Arguments are (K, keys, descending) where K holds keys column-major and
+// descending is boolean or array of booleans, returns stable row order
+// --------------------
+Napi::Value NativeModule::argsort(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "argsort expects keys and number of keys").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> k_buffer;
+  const double* K = nullptr;
+  size_t n, nkeys;
+  if(!readNumbers(env, info[0], "Keys", k_buffer, K, n) ||
+      !readDimensions(info, 1, 1, "Number of keys", &nkeys)) {
+    return env.Null();
+  }
+  if(nkeys == 0 || n % nkeys != 0) {
+    Napi::RangeError::New(env, "Keys length must be a multiple of number of keys").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(n / nkeys > 0xFFFFFFFFu) {
+    Napi::RangeError::New(env, "Keys are too large to sort").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<bool> descending(nkeys, false);
+  if(info.Length() > 2 && info[2].IsArray()) {
+    Napi::Array directions = info[2].As<Napi::Array>();
+    if(directions.Length() != nkeys) {
+      Napi::RangeError::New(env, "Number of directions must match number of keys").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+    for(uint32_t j = 0; j < nkeys; ++j) {
+      descending[j] = directions.Get(j).ToBoolean();
+    }
+  } else if(info.Length() > 2) {
+    std::fill(descending.begin(), descending.end(),
+      (bool)info[2].ToBoolean());
+  }
+
+  size_t N = n / nkeys;
+  Napi::Uint32Array jsResult = Napi::Uint32Array::New(env, N);
+  argsortKernel(K, N, nkeys, descending, jsResult.Data());
+  return jsResult;
+}
+
+// prctile() function
+// Arguments are (X, channels, p), percentiles of each channel ignoring NaN
+// values are returned channel by channel
+// --------------------
+Napi::Value NativeModule::prctile(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3) {
+    Napi::TypeError::New(env, "prctile expects data, channels and percentiles").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer, p_buffer;
+  const double* x = nullptr;
+  const double* p = nullptr;
+  size_t n, np, channels;
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, n) ||
+      !readDimensions(info, 1, 1, "Number of channels", &channels) ||
+      !readNumbers(env, info[2], "Percentiles", p_buffer, p, np)) {
+    return env.Null();
+  }
+  if(channels == 0 || n % channels != 0) {
+    Napi::RangeError::New(env, "Data length must be a multiple of number of channels").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  for(size_t k = 0; k < np; ++k) {
+    if(!(p[k] >= 0 && p[k] <= 100)) {
+      Napi::RangeError::New(env, "Percentiles must be in range [0, 100]").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+
+  size_t N = n / channels;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, np * channels);
+  double* y = jsResult.Data();
+  parallelFor(channels, [&](size_t c) {
+    prctileKernel(x + c * N, N, p, np, y + c * np);
+  });
+  return jsResult;
+}
+
+}// namespace native_module_ns
@@ -0,0 +1,270 @@
+// JSLAB - native-module-sparse.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// sparse() function
+// Arguments are (I, J, V, rows, cols) with zero-based indices, returns 
+// native sparse matrix, duplicate entries are summed
+// --------------------
+Napi::Value NativeModule::sparse(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  return env.GetInstanceData<AddonData>()->nativeSparseMatrix.New(
+    {info[0], info[1], info[2], info[3], info[4]});
+}
+
+// NativeSparseMatrix()
+// Object constructor, arguments are (I, J, V, rows, cols)
+// --------------------
+NativeSparseMatrix::NativeSparseMatrix(const Napi::CallbackInfo& info)
+    : Napi::ObjectWrap<NativeSparseMatrix>(info) {
+  Napi::Env env = info.Env();
+  this->lastIterations = 0;
+  this->lastError = 0;
+
+  std::vector<double> i_buffer, j_buffer, v_buffer;
+  const double* I = nullptr;
+  const double* J = nullptr;
+  const double* V = nullptr;
+  size_t ni = 0, nj = 0, nv = 0;
+  size_t dims[2];
+  if(info.Length() < 5 ||
+      !readNumbers(env, info[0], "I", i_buffer, I, ni) ||
+      !readNumbers(env, info[1], "J", j_buffer, J, nj) ||
+      !readNumbers(env, info[2], "V", v_buffer, V, nv) ||
+      !readDimensions(info, 3, 2, "Matrix dimensions", dims)) {
+    if(info.Length() < 5) {
+      Napi::TypeError::New(env, "Expected I, J, V, rows and cols").ThrowAsJavaScriptException();
+    }
+    return;
+  }
+  if(ni != nj || ni != nv) {
+    Napi::RangeError::New(env, "I, J and V must have the same length").ThrowAsJavaScriptException();
+    return;
+  }
+
+  std::vector<Triplet<double>> triplets;
+  triplets.reserve(nv);
+  for(size_t k = 0; k < nv; ++k) {
+    if(I[k] < 0 || J[k] < 0 || I[k] >= dims[0] || J[k] >= dims[1]) {
+      Napi::RangeError::New(env, "Index exceeds matrix dimensions").ThrowAsJavaScriptException();
+      return;
+    }
+    triplets.emplace_back((int)I[k], (int)J[k], V[k]);
+  }
+  this->matrix.resize(dims[0], dims[1]);
+  this->matrix.setFromTriplets(triplets.begin(), triplets.end());
+  this->matrix.makeCompressed();
+}
+
+// ~NativeSparseMatrix()
+// Object destructor
+// --------------------
+NativeSparseMatrix::~NativeSparseMatrix() {
+}
+
+// Init() function
+// --------------------
+Napi::Function NativeSparseMatrix::Init(Napi::Env env) {
+  return DefineClass(env, "NativeSparseMatrix", {
+    InstanceMethod("multiply", &NativeSparseMatrix::MultiplyJS),
+    InstanceMethod("solve", &NativeSparseMatrix::SolveJS),
+    InstanceMethod("getSolverInfo", &NativeSparseMatrix::GetSolverInfoJS),
+    InstanceMethod("getSize", &NativeSparseMatrix::GetSizeJS),
+    InstanceMethod("nnz", &NativeSparseMatrix::NnzJS),
+    InstanceMethod("toDense", &NativeSparseMatrix::ToDenseJS),
+    InstanceMethod("getTriplets", &NativeSparseMatrix::GetTripletsJS)
+  });
+}
+
+// solve() function
+// Direct factorizations are kept and reused for following solves
+// --------------------
+bool NativeSparseMatrix::solve(Napi::Env env, const double* b, size_t nrhs, 
+    double* x, const std::string& method, double tol, int max_iterations) {
+  Map<const MatrixXd> B(b, this->matrix.rows(), nrhs);
+  Map<MatrixXd> X(x, this->matrix.cols(), nrhs);
+  if(this->matrix.rows() != this->matrix.cols()) {
+    Napi::RangeError::New(env, "Matrix must be square").ThrowAsJavaScriptException();
+    return false;
+  }
+  if(method == "ldlt") {
+    if(!this->ldlt) {
+      this->ldlt.reset(new SimplicialLDLT<SpMat>());
+      this->ldlt->compute(this->matrix);
+    }
+    if(this->ldlt->info() != Success) {
+      this->ldlt.reset();
+      Napi::Error::New(env, "LDLT factorization failed").ThrowAsJavaScriptException();
+      return false;
+    }
+    X = this->ldlt->solve(B);
+  } else if(method == "lu") {
+    if(!this->lu) {
+      this->lu.reset(new SparseLU<SpMat>());
+      this->lu->analyzePattern(this->matrix);
+      this->lu->factorize(this->matrix);
+    }
+    if(this->lu->info() != Success) {
+      this->lu.reset();
+      Napi::Error::New(env, "LU factorization failed, matrix is singular").ThrowAsJavaScriptException();
+      return false;
+    }
+    X = this->lu->solve(B);
+  } else if(method == "cg") {
+    ConjugateGradient<SpMat, Lower|Upper> solver;
+    solver.setTolerance(tol);
+    if(max_iterations > 0) {
+      solver.setMaxIterations(max_iterations);
+    }
+    solver.compute(this->matrix);
+    X = solver.solve(B);
+    this->lastIterations = solver.iterations();
+    this->lastError = solver.error();
+  } else if(method == "bicgstab") {
+    BiCGSTAB<SpMat> solver;
+    solver.setTolerance(tol);
+    if(max_iterations > 0) {
+      solver.setMaxIterations(max_iterations);
+    }
+    solver.compute(this->matrix);
+    X = solver.solve(B);
+    this->lastIterations = solver.iterations();
+    this->lastError = solver.error();
+  } else {
+    Napi::TypeError::New(env, "Method must be 'ldlt', 'lu', 'cg' or 'bicgstab'").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// MultiplyJS() function
+// Sparse-dense product with column-major dense matrix
+// --------------------
+Napi::Value NativeSparseMatrix::MultiplyJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t n = 0;
+  if(info.Length() < 1 || !readNumbers(env, info[0], "X", x_buffer, x, n)) {
+    return env.Null();
+  }
+  size_t cols = this->matrix.cols();
+  if(cols == 0 || n % cols != 0) {
+    Napi::RangeError::New(env, "Number of elements of X must be a multiple of cols").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t k = n / cols;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, this->matrix.rows() * k);
+  Map<MatrixXd>(jsResult.Data(), this->matrix.rows(), k).noalias() = 
+    this->matrix * Map<const MatrixXd>(x, cols, k);
+  return jsResult;
+}
+
+// SolveJS() function
+// Arguments are (B, method, options) with options tol and maxIterations
+// --------------------
+Napi::Value NativeSparseMatrix::SolveJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  std::vector<double> b_buffer;
+  const double* b = nullptr;
+  size_t n = 0;
+  if(info.Length() < 1 || !readNumbers(env, info[0], "B", b_buffer, b, n)) {
+    return env.Null();
+  }
+  size_t rows = this->matrix.rows();
+  if(rows == 0 || n % rows != 0) {
+    Napi::RangeError::New(env, "Number of elements of B must be a multiple of rows").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::string method = info.Length() > 1 && info[1].IsString() ? 
+    info[1].As<Napi::String>().Utf8Value() : "lu";
+  double tol = std::numeric_limits<double>::epsilon();
+  int max_iterations = 0;
+  if(info.Length() > 2 && info[2].IsObject()) {
+    Napi::Object options = info[2].As<Napi::Object>();
+    if(options.Get("tol").IsNumber()) {
+      tol = options.Get("tol").As<Napi::Number>().DoubleValue();
+    }
+    if(options.Get("maxIterations").IsNumber()) {
+      max_iterations = options.Get("maxIterations").As<Napi::Number>().Int32Value();
+    }
+  }
+
+  size_t nrhs = n / rows;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, this->matrix.cols() * nrhs);
+  if(!this->solve(env, b, nrhs, jsResult.Data(), method, tol, max_iterations)) {
+    return env.Null();
+  }
+  return jsResult;
+}
+
+// GetSolverInfoJS() function
+// --------------------
+Napi::Value NativeSparseMatrix::GetSolverInfoJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("iterations", Napi::Number::New(env, (double)this->lastIterations));
+  jsResult.Set("error", Napi::Number::New(env, this->lastError));
+  return jsResult;
+}
+
+// GetSizeJS() function
+// --------------------
+Napi::Value NativeSparseMatrix::GetSizeJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Array jsResult = Napi::Array::New(env, 2);
+  jsResult.Set((uint32_t)0, Napi::Number::New(env, (double)this->matrix.rows()));
+  jsResult.Set((uint32_t)1, Napi::Number::New(env, (double)this->matrix.cols()));
+  return jsResult;
+}
+
+// NnzJS() function
+// --------------------
+Napi::Value NativeSparseMatrix::NnzJS(const Napi::CallbackInfo& info) {
+  return Napi::Number::New(info.Env(), (double)this->matrix.nonZeros());
+}
+
+// ToDenseJS() function
+// --------------------
+Napi::Value NativeSparseMatrix::ToDenseJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, 
+    this->matrix.rows() * this->matrix.cols());
+  Map<MatrixXd>(jsResult.Data(), this->matrix.rows(), this->matrix.cols()) = 
+    MatrixXd(this->matrix);
+  return jsResult;
+}
+
+// GetTripletsJS() function
+// --------------------
+Napi::Value NativeSparseMatrix::GetTripletsJS(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+  size_t nnz = this->matrix.nonZeros();
+  Napi::Uint32Array I = Napi::Uint32Array::New(env, nnz);
+  Napi::Uint32Array J = Napi::Uint32Array::New(env, nnz);
+  Napi::Float64Array V = Napi::Float64Array::New(env, nnz);
+  size_t p = 0;
+  for(int k = 0; k < this->matrix.outerSize(); ++k) {
+    for(SpMat::InnerIterator it(this->matrix, k); it; ++it) {
+      I[p] = (uint32_t)it.row();
+      J[p] = (uint32_t)it.col();
+      V[p] = it.value();
+      p++;
+    }
+  }
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("I", I);
+  jsResult.Set("J", J);
+  jsResult.Set("V", V);
+  return jsResult;
+}
+
+}  // namespace native_module_ns
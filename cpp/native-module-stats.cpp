@@ -0,0 +1,509 @@
+// JSLAB - native-module-stats.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "native-module.h"
+
+namespace native_module_ns {
+
+// movstatMethod() function
+// Returns statistic index or -1 for unknown statistic
+// --------------------
+int movstatMethod(const std::string& stat) {
+  static const char* names[] = {"sum", "mean", "var", "std", "min", "max",
+    "median"};
+  for(int i = 0; i < 7; ++i) {
+    if(stat == names[i]) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// movstatMoments() function
+// Sliding sum with compensated summation and sliding mean and variance with
+// Welford updates, windows containing NaN give NaN and windows of equal 
+// values give exactly zero variance
+// --------------------
+void movstatMoments(const double* x, size_t N, size_t kb, size_t kf,
+    int stat, double* y) {
+  double sum = 0, comp = 0, mean = 0, M2 = 0;
+  size_t n = 0, nans = 0, lo = 0, hi = 0, same = 0;
+  auto add = [&](double v, double sign) {
+    double t = sum + sign * v;
+    if(std::abs(sum) >= std::abs(v)) {
+      comp += (sum - t) + sign * v;
+    } else {
+      comp += (sign * v - t) + sum;
+    }
+    sum = t;
+  };
+  for(size_t i = 0; i < N; ++i) {
+    size_t wlo = i > kb ? i - kb : 0;
+    size_t whi = (std::min)(N, i + kf + 1);
+    for(; hi < whi; ++hi) {
+      double v = x[hi];
+      same = (hi > 0 && v == x[hi - 1]) ? same + 1 : 1;
+      if(std::isnan(v)) {
+        nans++;
+        continue;
+      }
+      add(v, 1.0);
+      n++;
+      double d = v - mean;
+      mean += d / n;
+      M2 += d * (v - mean);
+    }
+    for(; lo < wlo; ++lo) {
+      double v = x[lo];
+      if(std::isnan(v)) {
+        nans--;
+        continue;
+      }
+      add(v, -1.0);
+      n--;
+      if(n == 0) {
+        mean = 0;
+        M2 = 0;
+        sum = 0;
+        comp = 0;
+      } else {
+        double d = v - mean;
+        mean -= d / n;
+        M2 -= d * (v - mean);
+      }
+    }
+    if(nans > 0) {
+      y[i] = std::numeric_limits<double>::quiet_NaN();
+    } else if(stat == MOVSTAT_SUM) {
+      y[i] = sum + comp;
+    } else if(stat == MOVSTAT_MEAN) {
+      y[i] = n > 0 ? (sum + comp) / n : std::numeric_limits<double>::quiet_NaN();
+    } else {
+      double var = (n > 1 && same < n) ? (std::max)(0.0, M2 / (n - 1)) : 0.0;
+      y[i] = stat == MOVSTAT_STD ? std::sqrt(var) : var;
+    }
+  }
+}
+
+// movstatExtreme() function
+// Sliding minimum or maximum with monotonic deque of indices
+// --------------------
+void movstatExtreme(const double* x, size_t N, size_t kb, size_t kf,
+    bool maximum, double* y) {
+  std::deque<size_t> dq;
+  size_t nans = 0, lo = 0, hi = 0;
+  for(size_t i = 0; i < N; ++i) {
+    size_t wlo = i > kb ? i - kb : 0;
+    size_t whi = (std::min)(N, i + kf + 1);
+    for(; hi < whi; ++hi) {
+      double v = x[hi];
+      if(std::isnan(v)) {
+        nans++;
+        continue;
+      }
+      while(!dq.empty() && (maximum ? x[dq.back()] <= v : x[dq.back()] >= v)) {
+        dq.pop_back();
+      }
+      dq.push_back(hi);
+    }
+    for(; lo < wlo; ++lo) {
+      if(std::isnan(x[lo])) {
+        nans--;
+      }
+    }
+    while(!dq.empty() && dq.front() < wlo) {
+      dq.pop_front();
+    }
+    y[i] = (nans > 0 || dq.empty()) ?
+      std::numeric_limits<double>::quiet_NaN() : x[dq.front()];
+  }
+}
+
+// movstatMedian() function
+// Sliding median with two balanced multisets, lower half holds middle
+// element of odd sized windows
+// --------------------
+void movstatMedian(const double* x, size_t N, size_t kb, size_t kf,
+    double* y) {
+  std::multiset<double> low, high;
+  size_t nans = 0, lo = 0, hi = 0;
+  auto balance = [&]() {
+    if(low.size() > high.size() + 1) {
+      auto it = std::prev(low.end());
+      high.insert(*it);
+      low.erase(it);
+    } else if(high.size() > low.size()) {
+      auto it = high.begin();
+      low.insert(*it);
+      high.erase(it);
+    }
+  };
+  for(size_t i = 0; i < N; ++i) {
+    size_t wlo = i > kb ? i - kb : 0;
+    size_t whi = (std::min)(N, i + kf + 1);
+    for(; hi < whi; ++hi) {
+      double v = x[hi];
+      if(std::isnan(v)) {
+        nans++;
+        continue;
+      }
+      if(low.empty() || v <= *low.rbegin()) {
+        low.insert(v);
+      } else {
+        high.insert(v);
+      }
+      balance();
+    }
+    for(; lo < wlo; ++lo) {
+      double v = x[lo];
+      if(std::isnan(v)) {
+        nans--;
+        continue;
+      }
+      if(v <= *low.rbegin()) {
+        low.erase(low.find(v));
+      } else {
+        high.erase(high.find(v));
+      }
+      balance();
+    }
+    if(nans > 0 || low.empty()) {
+      y[i] = std::numeric_limits<double>::quiet_NaN();
+    } else if(low.size() > high.size()) {
+      y[i] = *low.rbegin();
+    } else {
+      y[i] = 0.5 * (*low.rbegin() + *high.begin());
+    }
+  }
+}
+
+// movstatKernel() function
+// Statistic over windows of kb samples before and kf samples after each
+// sample, windows are shrunk at endpoints
+// --------------------
+void movstatKernel(const double* x, size_t N, size_t kb, size_t kf, int stat,
+    double* y) {
+  if(stat == MOVSTAT_MIN || stat == MOVSTAT_MAX) {
+    movstatExtreme(x, N, kb, kf, stat == MOVSTAT_MAX, y);
+  } else if(stat == MOVSTAT_MEDIAN) {
+    movstatMedian(x, N, kb, kf, y);
+  } else {
+    movstatMoments(x, N, kb, kf, stat, y);
+  }
+}
+
+// movstat() function
+// Arguments are (X, channels, stat, kb, kf, endpoints) where endpoints is
+// 'shrink', 'discard' or fill value, each channel is processed in parallel
+// --------------------
+Napi::Value NativeModule::movstat(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 5) {
+    Napi::TypeError::New(env, "movstat expects data, channels, statistic and window").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t n, dims[3];
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, n) ||
+      !readDimensions(info, 1, 1, "Number of channels", dims)) {
+    return env.Null();
+  }
+  int stat = info[2].IsString() ?
+    movstatMethod(info[2].As<Napi::String>().Utf8Value()) : -1;
+  if(stat < 0) {
+    Napi::TypeError::New(env, "Statistic must be 'sum', 'mean', 'var', 'std', 'min', 'max' or 'median'").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readDimensions(info, 3, 2, "Window lengths", dims + 1)) {
+    return env.Null();
+  }
+  size_t channels = dims[0], kb = dims[1], kf = dims[2];
+  if(channels == 0 || n % channels != 0) {
+    Napi::RangeError::New(env, "Data length must be a multiple of number of channels").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  bool discard = false;
+  bool fill = false;
+  double fill_value = std::numeric_limits<double>::quiet_NaN();
+  if(info.Length() > 5 && info[5].IsString()) {
+    std::string endpoints = info[5].As<Napi::String>().Utf8Value();
+    if(endpoints == "discard") {
+      discard = true;
+    } else if(endpoints == "fill") {
+      fill = true;
+    } else if(endpoints != "shrink") {
+      Napi::TypeError::New(env, "Endpoints must be 'shrink', 'discard', 'fill' or fill value").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  } else if(info.Length() > 5 && info[5].IsNumber()) {
+    fill = true;
+    fill_value = info[5].As<Napi::Number>().DoubleValue();
+  }
+
+  // Samples with complete windows
+  size_t N = n / channels;
+  size_t first = (std::min)(kb, N);
+  size_t last = N > kf ? N - kf : 0;
+  size_t count = last > first ? last - first : 0;
+  size_t M = discard ? count : N;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, M * channels);
+  double* y = jsResult.Data();
+  parallelFor(channels, [&](size_t c) {
+    if(!discard) {
+      double* yc = y + c * N;
+      movstatKernel(x + c * N, N, kb, kf, stat, yc);
+      if(fill) {
+        for(size_t i = 0; i < N; ++i) {
+          if(i < first || i >= last) {
+            yc[i] = fill_value;
+          }
+        }
+      }
+    } else {
+      std::vector<double> yc(N);
+      movstatKernel(x + c * N, N, kb, kf, stat, yc.data());
+      std::copy(yc.begin() + first, yc.begin() + first + count, y + c * M);
+    }
+  });
+  return jsResult;
+}
+
+// momentsAdd() function
+// Welford update of count, mean, central sums, extremes and NaN count
+// --------------------
+void momentsAdd(Moments& m, double x) {
+  if(std::isnan(x)) {
+    m.nans++;
+    return;
+  }
+  double n1 = m.n;
+  m.n += 1;
+  double delta = x - m.mean;
+  double dn = delta / m.n;
+  double dn2 = dn * dn;
+  double term = delta * dn * n1;
+  m.mean += dn;
+  m.M4 += term * dn2 * (m.n * m.n - 3 * m.n + 3) + 6 * dn2 * m.M2 -
+    4 * dn * m.M3;
+  m.M3 += term * dn * (m.n - 2) - 3 * dn * m.M2;
+  m.M2 += term;
+  m.min = (std::min)(m.min, x);
+  m.max = (std::max)(m.max, x);
+}
+
+// momentsMerge() function
+// Combines moments of two disjoint parts of data
+// --------------------
+Moments momentsMerge(const Moments& a, const Moments& b) {
+  if(a.n == 0 || b.n == 0) {
+    Moments m = a.n == 0 ? b : a;
+    m.nans = a.nans + b.nans;
+    return m;
+  }
+  Moments m;
+  double n = a.n + b.n;
+  double delta = b.mean - a.mean;
+  double delta2 = delta * delta;
+  double na = a.n, nb = b.n;
+  m.n = n;
+  m.mean = a.mean + delta * nb / n;
+  m.M2 = a.M2 + b.M2 + delta2 * na * nb / n;
+  m.M3 = a.M3 + b.M3 + delta2 * delta * na * nb * (na - nb) / (n * n) +
+    3 * delta * (na * b.M2 - nb * a.M2) / n;
+  m.M4 = a.M4 + b.M4 + delta2 * delta2 * na * nb * (na * na - na * nb + nb * nb) /
+    (n * n * n) + 6 * delta2 * (na * na * b.M2 + nb * nb * a.M2) / (n * n) +
+    4 * delta * (na * b.M3 - nb * a.M3) / n;
+  m.min = (std::min)(a.min, b.min);
+  m.max = (std::max)(a.max, b.max);
+  m.nans = a.nans + b.nans;
+  return m;
+}
+
+// momentsKernel() function
+// Moments of fixed size blocks merged pairwise, block layout does not depend
+// on number of threads so result is reproducible
+// --------------------
+Moments momentsKernel(const double* x, size_t N, bool parallel) {
+  const size_t BLOCK = 4096;
+  size_t blocks = (std::max)((size_t)1, (N + BLOCK - 1) / BLOCK);
+  std::vector<Moments> parts(blocks);
+  auto accumulate = [&](size_t k) {
+    size_t hi = (std::min)(N, (k + 1) * BLOCK);
+    for(size_t i = k * BLOCK; i < hi; ++i) {
+      momentsAdd(parts[k], x[i]);
+    }
+  };
+  if(parallel && blocks > 1) {
+    parallelFor(blocks, accumulate);
+  } else {
+    for(size_t k = 0; k < blocks; ++k) {
+      accumulate(k);
+    }
+  }
+  for(size_t width = 1; width < blocks; width *= 2) {
+    for(size_t k = 0; k + width < blocks; k += 2 * width) {
+      parts[k] = momentsMerge(parts[k], parts[k + width]);
+    }
+  }
+  return parts[0];
+}
+
+// describe() function
+// Arguments are (X, channels), returns count, mean, var, std, skewness, 
+// kurtosis, min, max and NaN count of each channel ignoring NaN values
+// --------------------
+Napi::Value NativeModule::describe(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 1) {
+    Napi::TypeError::New(env, "describe expects data").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  size_t n, channels = 1;
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, n) ||
+      (info.Length() > 1 && !readDimensions(info, 1, 1, "Number of channels", &channels))) {
+    return env.Null();
+  }
+  if(channels == 0 || n % channels != 0) {
+    Napi::RangeError::New(env, "Data length must be a multiple of number of channels").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  size_t N = n / channels;
+  std::vector<Moments> moments(channels);
+  if(channels == 1) {
+    moments[0] = momentsKernel(x, N, true);
+  } else {
+    parallelFor(channels, [&](size_t c) {
+      moments[c] = momentsKernel(x + c * N, N, false);
+    });
+  }
+
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const char* names[] = {"count", "mean", "var", "std", "skewness", 
+    "kurtosis", "min", "max", "nanCount"};
+  Napi::Object result = Napi::Object::New(env);
+  for(int j = 0; j < 9; ++j) {
+    Napi::Float64Array jsValues = Napi::Float64Array::New(env, channels);
+    double* y = jsValues.Data();
+    for(size_t c = 0; c < channels; ++c) {
+      const Moments& m = moments[c];
+      double var = m.n > 1 ? m.M2 / (m.n - 1) : (m.n == 1 ? 0 : nan);
+      switch(j) {
+        case 0: y[c] = m.n; break;
+        case 1: y[c] = m.n > 0 ? m.mean : nan; break;
+        case 2: y[c] = var; break;
+        case 3: y[c] = std::sqrt(var); break;
+        case 4: y[c] = m.n > 0 ? std::sqrt(m.n) * m.M3 / std::pow(m.M2, 1.5) : nan; break;
+        case 5: y[c] = m.n > 0 ? m.n * m.M4 / (m.M2 * m.M2) : nan; break;
+        case 6: y[c] = m.n > 0 ? m.min : nan; break;
+        case 7: y[c] = m.n > 0 ? m.max : nan; break;
+        default: y[c] = m.nans; break;
+      }
+    }
+    result.Set(names[j], jsValues);
+  }
+  return result;
+}
+
+// histBin() function
+// Bin of value for ascending edges, uniform edges are binned in O(1) with
+// correction of rounding, returns -1 for values outside edges or NaN
+// --------------------
+long histBin(double v, const double* edges, size_t nbins, bool uniform, 
+    double width) {
+  if(!(v >= edges[0] && v <= edges[nbins])) {
+    return -1;
+  }
+  long bin;
+  if(uniform) {
+    bin = (long)((v - edges[0]) / width);
+    bin = (std::min)((std::max)(bin, 0L), (long)nbins - 1);
+    if(v < edges[bin]) {
+      bin--;
+    } else if(bin + 1 < (long)nbins && v >= edges[bin + 1]) {
+      bin++;
+    }
+  } else {
+    bin = (long)(std::upper_bound(edges, edges + nbins + 1, v) - edges) - 1;
+  }
+  return (std::min)(bin, (long)nbins - 1);
+}
+
+// histcounts() function
+// Arguments are (X, edges), bins are [e(i), e(i+1)) with last bin closed, 
+// data is split into one contiguous part per thread, each counted into its
+// own partial histogram and summed
+// --------------------
+Napi::Value NativeModule::histcounts(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "histcounts expects data and edges").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  std::vector<double> x_buffer, e_buffer;
+  const double* x = nullptr;
+  const double* edges = nullptr;
+  size_t n, ne;
+  if(!readNumbers(env, info[0], "Data", x_buffer, x, n) ||
+      !readNumbers(env, info[1], "Edges", e_buffer, edges, ne)) {
+    return env.Null();
+  }
+  if(ne < 2) {
+    Napi::RangeError::New(env, "At least two edges are required").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  for(size_t i = 0; i + 1 < ne; ++i) {
+    if(!(edges[i] < edges[i + 1])) {
+      Napi::RangeError::New(env, "Edges must be increasing").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+
+  size_t nbins = ne - 1;
+  double width = (edges[nbins] - edges[0]) / nbins;
+  bool uniform = std::isfinite(width);
+  for(size_t i = 1; uniform && i < nbins; ++i) {
+    uniform = std::abs(edges[i] - (edges[0] + i * width)) <= 
+      1e-12 * (std::max)(std::abs(edges[0]), std::abs(edges[nbins]));
+  }
+
+  const size_t MIN_PART = 65536;
+  size_t parts = (std::min)(
+    (size_t)(std::max)(1u, std::thread::hardware_concurrency()),
+    (std::max)((size_t)1, n / MIN_PART));
+  size_t part = (n + parts - 1) / parts;
+  std::vector<std::vector<double>> counts(parts, 
+    std::vector<double>(nbins, 0));
+  parallelFor(parts, [&](size_t k) {
+    size_t lo = (std::min)(n, k * part);
+    size_t hi = (std::min)(n, lo + part);
+    double* ck = counts[k].data();
+    for(size_t i = lo; i < hi; ++i) {
+      long bin = histBin(x[i], edges, nbins, uniform, width);
+      if(bin >= 0) {
+        ck[bin]++;
+      }
+    }
+  });
+
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, nbins);
+  double* y = jsResult.Data();
+  std::fill(y, y + nbins, 0.0);
+  for(size_t k = 0; k < parts; ++k) {
+    for(size_t b = 0; b < nbins; ++b) {
+      y[b] += counts[k][b];
+    }
+  }
+  return jsResult;
+}
+
+}// namespace native_module_ns
@@ -20,39 +20,14 @@ long toc(const time_point<steady_clock>& startTime) {
 }
 #endif
 
-// Function to get current time
-std::string getCurrentTime() {
-  // get current time
-  auto now = system_clock::now();
-
-  // get number of milliseconds for the current second
-  // (remainder after division into seconds)
-  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
-
-  // convert to std::time_t in order to convert to std::tm (broken time)
-  auto timer = system_clock::to_time_t(now);
-
-  // convert to broken time
-  std::tm bt = *std::localtime(&timer);
-
-  std::ostringstream oss;
-
-  oss << std::put_time(&bt, "%H:%M:%S"); // HH:MM:SS
-  oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-
-  return oss.str();
-}
-
 // Function to console log data
 int consoleLog(uint8_t level, const char* format, ...) {
 #ifdef DEBUG_NATIVE_MODULE_LEVEL
   if(level <= DEBUG_NATIVE_MODULE_LEVEL) {
-    printf("\033[0;33m[%s NativeModule]\033[0m ", getCurrentTime().c_str());
     va_list vl;
     va_start(vl, format);
-    auto ret = vprintf(format, vl);
+    auto ret = consoleLogV("NativeModule", format, vl);
     va_end(vl);
-    printf("\n");
     return ret;
   }
 #endif
@@ -83,14 +58,61 @@ Napi::Object NativeModule::Init(Napi::Env env, Napi::Object exports) {
       DefineClass(env,
                   "NativeModule", {
                      InstanceMethod("roots", &NativeModule::roots),
+                     InstanceMethod("rootsBatch", &NativeModule::rootsBatch),
                      InstanceMethod("cumtrapz", &NativeModule::cumtrapz),
                      InstanceMethod("trapz", &NativeModule::trapz),
+                     InstanceMethod("trapzMatrix", &NativeModule::trapzMatrix),
+                     InstanceMethod("cumtrapzMatrix", &NativeModule::cumtrapzMatrix),
+                     InstanceMethod("simpsonMatrix", &NativeModule::simpsonMatrix),
+                     InstanceMethod("cumsimpsonMatrix", &NativeModule::cumsimpsonMatrix),
                      InstanceMethod("listSubprocesses", &NativeModule::listSubprocesses),
+                     InstanceMethod("matmul", &NativeModule::matmul),
+                     InstanceMethod("factorize", &NativeModule::factorize),
+                     InstanceMethod("inv", &NativeModule::inv),
+                     InstanceMethod("det", &NativeModule::det),
+                     InstanceMethod("linsolve", &NativeModule::linsolve),
+                     InstanceMethod("eig", &NativeModule::eig),
+                     InstanceMethod("svd", &NativeModule::svd),
+                     InstanceMethod("pinv", &NativeModule::pinv),
+                     InstanceMethod("rank", &NativeModule::rank),
+                     InstanceMethod("cond", &NativeModule::cond),
+                     InstanceMethod("charpoly", &NativeModule::charpoly),
+                     InstanceMethod("expm", &NativeModule::expm),
+                     InstanceMethod("sparse", &NativeModule::sparse),
+                     InstanceMethod("c2d", &NativeModule::c2d),
+                     InstanceMethod("lsim", &NativeModule::lsim),
+                     InstanceMethod("lsimBatch", &NativeModule::lsimBatch),
+                     InstanceMethod("lsimSS", &NativeModule::lsimSS),
+                     InstanceMethod("tfest", &NativeModule::tfest),
+                     InstanceMethod("interp1", &NativeModule::interp1),
+                     InstanceMethod("polyfit", &NativeModule::polyfit),
+                     InstanceMethod("polyfitBatch", &NativeModule::polyfitBatch),
+                     InstanceMethod("polyval", &NativeModule::polyval),
+                     InstanceMethod("polyvalBatch", &NativeModule::polyvalBatch),
+                     InstanceMethod("fft", &NativeModule::fft),
+                     InstanceMethod("fft2", &NativeModule::fft2),
+                     InstanceMethod("rfft", &NativeModule::rfft),
+                     InstanceMethod("irfft", &NativeModule::irfft),
+                     InstanceMethod("stft", &NativeModule::stft),
+                     InstanceMethod("pwelch", &NativeModule::pwelch),
+                     InstanceMethod("filter", &NativeModule::filter),
+                     InstanceMethod("filtfilt", &NativeModule::filtfilt),
+                     InstanceMethod("conv", &NativeModule::conv),
+                     InstanceMethod("deconv", &NativeModule::deconv),
+                     InstanceMethod("decimate", &NativeModule::decimate),
+                     InstanceMethod("resample", &NativeModule::resample),
+                     InstanceMethod("movstat", &NativeModule::movstat),
+                     InstanceMethod("describe", &NativeModule::describe),
+                     InstanceMethod("histcounts", &NativeModule::histcounts),
+                     InstanceMethod("sort", &NativeModule::sort),
+                     InstanceMethod("argsort", &NativeModule::argsort),
+                     InstanceMethod("prctile", &NativeModule::prctile),
+                     InstanceMethod("rng", &NativeModule::rng),
+                     InstanceMethod("ndarray", &NativeModule::ndarray),
                    });
                    
-  Napi::FunctionReference* constructor = new Napi::FunctionReference();
-  *constructor = Napi::Persistent(func);
-  env.SetInstanceData(constructor);
+  AddonData* data = env.GetInstanceData<AddonData>();
+  data->nativeModule = Napi::Persistent(func);
 
   exports.Set("NativeModule", func);
   return exports;
@@ -152,98 +174,386 @@ Napi::Value NativeModule::roots(const Napi::CallbackInfo& info) {
   return result;
 }
 
-// cumtrapz() function
+// companionRoots() function
+// Roots as eigenvalues of companion matrix, coefficients from highest degree
 // --------------------
-Napi::Value NativeModule::cumtrapz(const Napi::CallbackInfo& info) {
-  Napi::Env env = info.Env();
+void companionRoots(const double* c, int degree, std::complex<double>* roots) {
+  if(degree < 1) {
+    return;
+  }
+  MatrixXd companionMatrix = MatrixXd::Zero(degree, degree);
+  for(int i = 1; i < degree; ++i) {
+    companionMatrix(i, i - 1) = 1.0;
+  }
+  for(int i = 0; i < degree; ++i) {
+    companionMatrix(i, degree - 1) = -c[degree - i] / c[0];
+  }
+  EigenSolver<MatrixXd> solver(companionMatrix, false);
+  VectorXcd ev = solver.eigenvalues();
+  for(int i = 0; i < degree; ++i) {
+    roots[i] = ev(i);
+  }
+}
 
-  // Ensure at least one argument is provided
-  if(info.Length() < 1) {
-    Napi::TypeError::New(env, "cumtrapz expects at least one argument").ThrowAsJavaScriptException();
-    return env.Null();
+// aberthRoots() function
+// Aberth-Ehrlich simultaneous iteration, O(n^2) per iteration. Initial 
+// guesses are spread on a circle with radius from the Fujiwara bound.
+// --------------------
+void aberthRoots(const double* c, int degree, std::complex<double>* z) {
+  typedef std::complex<double> cd;
+  if(degree < 1) {
+    return;
+  }
+  if(degree == 1) {
+    z[0] = -c[1] / c[0];
+    return;
+  }
+  
+  double radius = 0.0;
+  for(int k = 1; k <= degree; ++k) {
+    double v = std::pow(std::abs(c[k] / c[0]), 1.0 / k);
+    if(k == degree) {
+      v = std::pow(std::abs(c[k] / (2 * c[0])), 1.0 / k);
+    }
+    radius = (std::max)(radius, 2.0 * v);
+  }
+  if(radius == 0.0) {
+    std::fill(z, z + degree, cd(0.0, 0.0));
+    return;
+  }
+  const double PI = 3.14159265358979323846;
+  for(int i = 0; i < degree; ++i) {
+    double angle = 2.0 * PI * i / degree + 0.4;
+    z[i] = std::polar(radius, angle);
   }
 
-  // Ensure the first argument is an array
-  if(!info[0].IsArray()) {
-    Napi::TypeError::New(env, "First argument must be an array").ThrowAsJavaScriptException();
-    return env.Null();
+  const int MAX_ITERATIONS = 500;
+  const double EPS = std::numeric_limits<double>::epsilon();
+  std::vector<bool> converged(degree, false);
+  for(int iter = 0; iter < MAX_ITERATIONS; ++iter) {
+    int active = 0;
+    for(int i = 0; i < degree; ++i) {
+      if(converged[i]) {
+        continue;
+      }
+      // Horner evaluation of p and dp with error bound
+      cd p = c[0], dp = 0.0;
+      double bound = std::abs(c[0]);
+      double az = std::abs(z[i]);
+      for(int k = 1; k <= degree; ++k) {
+        dp = dp * z[i] + p;
+        p = p * z[i] + c[k];
+        bound = bound * az + std::abs(p);
+      }
+      if(std::abs(p) <= 4 * EPS * bound) {
+        converged[i] = true;
+        continue;
+      }
+      active++;
+      cd ratio = p / dp;
+      cd sum = 0.0;
+      for(int j = 0; j < degree; ++j) {
+        if(j != i) {
+          sum += 1.0 / (z[i] - z[j]);
+        }
+      }
+      cd w = ratio / (1.0 - ratio * sum);
+      z[i] -= w;
+      if(std::abs(w) <= EPS * std::abs(z[i])) {
+        converged[i] = true;
+      }
+    }
+    if(active == 0) {
+      break;
+    }
   }
+}
 
-  Napi::Array yInput = info[0].As<Napi::Array>();
-  Napi::Array xInput;
-  bool hasX = info.Length() > 1;
+// rootsBatch() function
+// Arguments are flat coefficients (Float64Array), offsets of polynomials 
+// (length count+1) and method ('aberth' or 'eig'). Leading zero 
+// coefficients are skipped, roots are returned as real and imag arrays 
+// with their own offsets.
+// --------------------
+Napi::Value NativeModule::rootsBatch(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
 
-  // If x is provided, ensure it's an array
-  if(hasX) {
-    if(!info[1].IsArray()) {
-      Napi::TypeError::New(env, "Second argument must be an array").ThrowAsJavaScriptException();
+  std::vector<double> c_buffer, o_buffer;
+  const double* c = nullptr;
+  const double* o = nullptr;
+  size_t nc = 0, no = 0;
+  if(info.Length() < 2) {
+    Napi::TypeError::New(env, "rootsBatch expects coefficients and offsets").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  if(!readNumbers(env, info[0], "Coefficients", c_buffer, c, nc)) {
+    return env.Null();
+  }
+  std::vector<size_t> offsets;
+  if(info[1].IsTypedArray() && 
+      info[1].As<Napi::TypedArray>().TypedArrayType() == napi_uint32_array) {
+    Napi::Uint32Array jsOffsets = info[1].As<Napi::Uint32Array>();
+    offsets.assign(jsOffsets.Data(), jsOffsets.Data() + jsOffsets.ElementLength());
+  } else {
+    if(!readNumbers(env, info[1], "Offsets", o_buffer, o, no)) {
+      return env.Null();
+    }
+    offsets.assign(o, o + no);
+  }
+  for(size_t k = 1; k < offsets.size(); ++k) {
+    if(offsets[k] < offsets[k - 1] || offsets[k] > nc) {
+      Napi::RangeError::New(env, "Offsets must be nondecreasing and within coefficients").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
+  bool aberth = true;
+  if(info.Length() > 2 && info[2].IsString()) {
+    std::string method = info[2].As<Napi::String>().Utf8Value();
+    if(method == "eig") {
+      aberth = false;
+    } else if(method != "aberth") {
+      Napi::TypeError::New(env, "Method must be 'aberth' or 'eig'").ThrowAsJavaScriptException();
       return env.Null();
     }
-    xInput = info[1].As<Napi::Array>();
   }
 
-  // Get the length of yInput
-  uint32_t n = yInput.Length();
-
-  // If x is provided, its length must match yInput
-  if(hasX && xInput.Length() != n) {
-    Napi::RangeError::New(env, "x and y arrays must have the same length").ThrowAsJavaScriptException();
-    return env.Null();
+  size_t count = offsets.empty() ? 0 : offsets.size() - 1;
+  std::vector<size_t> first(count);
+  std::vector<uint32_t> root_offsets(count + 1, 0);
+  for(size_t k = 0; k < count; ++k) {
+    size_t f = offsets[k];
+    while(f < offsets[k + 1] && c[f] == 0.0) {
+      f++;
+    }
+    first[k] = f;
+    size_t degree = offsets[k + 1] > f ? offsets[k + 1] - f - 1 : 0;
+    root_offsets[k + 1] = root_offsets[k] + (uint32_t)degree;
   }
 
-  // Handle empty array
-  if(n == 0) {
-    return Napi::Array::New(env, 0);
+  std::vector<std::complex<double>> roots(root_offsets[count]);
+  parallelFor(count, [&](size_t k) {
+    int degree = (int)(root_offsets[k + 1] - root_offsets[k]);
+    if(aberth) {
+      aberthRoots(c + first[k], degree, roots.data() + root_offsets[k]);
+    } else {
+      companionRoots(c + first[k], degree, roots.data() + root_offsets[k]);
+    }
+  });
+
+  Napi::Float64Array real = Napi::Float64Array::New(env, roots.size());
+  Napi::Float64Array imag = Napi::Float64Array::New(env, roots.size());
+  Napi::Uint32Array jsOffsets = Napi::Uint32Array::New(env, count + 1);
+  for(size_t i = 0; i < roots.size(); ++i) {
+    real[i] = roots[i].real();
+    imag[i] = roots[i].imag();
   }
+  std::copy(root_offsets.begin(), root_offsets.end(), jsOffsets.Data());
 
-  // Initialize Eigen vectors
-  Eigen::VectorXd y(n);
-  Eigen::VectorXd x(n);
-  Eigen::VectorXd result(n);
+  Napi::Object jsResult = Napi::Object::New(env);
+  jsResult.Set("real", real);
+  jsResult.Set("imag", imag);
+  jsResult.Set("offsets", jsOffsets);
+  return jsResult;
+}
 
-  // Load y values from JavaScript array
+// readNumbers() function
+// Float64Array is used in place, plain array is copied to buffer
+// --------------------
+bool readNumbers(Napi::Env env, const Napi::Value& value, const char* name, 
+    std::vector<double>& buffer, const double*& data, size_t& n) {
+  if(value.IsTypedArray() && 
+      value.As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+    Napi::Float64Array array = value.As<Napi::Float64Array>();
+    data = array.Data();
+    n = array.ElementLength();
+    return true;
+  }
+  if(!value.IsArray()) {
+    Napi::TypeError::New(env, std::string(name) + " must be an array or Float64Array").ThrowAsJavaScriptException();
+    return false;
+  }
+  Napi::Array array = value.As<Napi::Array>();
+  n = array.Length();
+  buffer.resize(n);
   for(uint32_t i = 0; i < n; ++i) {
-    Napi::Value val = yInput.Get(i);
+    Napi::Value val = array.Get(i);
     if(!val.IsNumber()) {
-      Napi::TypeError::New(env, "y array must contain only numbers").ThrowAsJavaScriptException();
-      return env.Null();
+      Napi::TypeError::New(env, std::string(name) + " array must contain only numbers").ThrowAsJavaScriptException();
+      return false;
     }
-    y[i] = val.As<Napi::Number>().DoubleValue();
+    buffer[i] = val.As<Napi::Number>().DoubleValue();
   }
+  data = buffer.data();
+  return true;
+}
 
-  // If x is provided, load x values; otherwise, assume uniform spacing
-  if(hasX) {
-    for(uint32_t i = 0; i < n; ++i) {
-      Napi::Value val = xInput.Get(i);
-      if (!val.IsNumber()) {
-        Napi::TypeError::New(env, "x array must contain only numbers").ThrowAsJavaScriptException();
-        return env.Null();
-      }
-      x[i] = val.As<Napi::Number>().DoubleValue();
+// trapzKernel() function
+// --------------------
+double trapzKernel(const double* y, const double* x, size_t n) {
+  if(n < 2) {
+    return 0.0;
+  }
+  Map<const ArrayXd> Y(y, n);
+  if(x == nullptr) {
+    // Uniform spacing: x = [0, 1, 2, ..., n-1]
+    return Y.sum() - 0.5 * (y[0] + y[n - 1]);
+  }
+  Map<const ArrayXd> X(x, n);
+  return 0.5 * ((X.tail(n - 1) - X.head(n - 1)) * 
+    (Y.tail(n - 1) + Y.head(n - 1))).sum();
+}
+
+// cumtrapzKernel() function
+// --------------------
+void cumtrapzKernel(const double* y, const double* x, size_t n, double* out,
+    size_t stride) {
+  if(n == 0) {
+    return;
+  }
+  double total = 0.0;
+  double y_prev = y[0];
+  out[0] = 0.0;
+  if(x == nullptr) {
+    for(size_t i = 1; i < n; ++i) {
+      double yi = y[i * stride];
+      total += 0.5 * (yi + y_prev);
+      y_prev = yi;
+      out[i * stride] = total;
     }
   } else {
-    // Uniform spacing: x = [0, 1, 2, ..., n-1]
-    for(uint32_t i = 0; i < n; ++i) {
-      x[i] = static_cast<double>(i);
+    for(size_t i = 1; i < n; ++i) {
+      double yi = y[i * stride];
+      total += 0.5 * (x[i] - x[i - 1]) * (yi + y_prev);
+      y_prev = yi;
+      out[i * stride] = total;
     }
   }
+}
 
-  // Initialize result: first value is always 0
-  result[0] = 0.0;
+// simpsonInterval() function
+// Integral over [x(i), x(i+1)] of the quadratic through three neighbouring 
+// points, as weights of y(base), y(base+1) and y(base+2). Intervals are 
+// paired so that even indices give composite Simpson's rule, last interval 
+// of an odd number of intervals uses the preceding pair.
+// --------------------
+void simpsonInterval(const double* x, size_t n, size_t i, size_t& base, 
+    double w[3]) {
+  bool first = (i % 2 == 0) && (i + 2 < n);
+  base = first ? i : i - 1;
+  double h1 = x ? x[base + 1] - x[base] : 1.0;
+  double h2 = x ? x[base + 2] - x[base + 1] : 1.0;
+  double H = h1 + h2;
+  if(first) {
+    w[0] = h1 * (3 * H - h1) / (6 * H);
+    w[1] = h1 * (3 * H - 2 * h1) / (6 * h2);
+    w[2] = -h1 * h1 * h1 / (6 * H * h2);
+  } else {
+    w[0] = -h2 * h2 * h2 / (6 * H * h1);
+    w[1] = h2 * (3 * H - 2 * h2) / (6 * h1);
+    w[2] = h2 * (3 * H - h2) / (6 * H);
+  }
+}
+
+// integrationWeights() function
+// Weights w so that the integral of y equals dot(w, y)
+// --------------------
+void integrationWeights(const double* x, size_t n, bool simpson, double* w) {
+  std::fill(w, w + n, 0.0);
+  if(n < 2) {
+    return;
+  }
+  if(!simpson || n < 3) {
+    for(size_t i = 0; i + 1 < n; ++i) {
+      double dx = x ? x[i + 1] - x[i] : 1.0;
+      w[i] += 0.5 * dx;
+      w[i + 1] += 0.5 * dx;
+    }
+    return;
+  }
+  for(size_t i = 0; i + 1 < n; ++i) {
+    size_t base;
+    double c[3];
+    simpsonInterval(x, n, i, base, c);
+    w[base] += c[0];
+    w[base + 1] += c[1];
+    w[base + 2] += c[2];
+  }
+}
+
+// cumsimpsonKernel() function
+// --------------------
+void cumsimpsonKernel(const double* y, const double* x, size_t n, double* out,
+    size_t stride) {
+  if(n < 3) {
+    cumtrapzKernel(y, x, n, out, stride);
+    return;
+  }
+  double total = 0.0;
+  out[0] = 0.0;
+  for(size_t i = 0; i + 1 < n; ++i) {
+    size_t base;
+    double c[3];
+    simpsonInterval(x, n, i, base, c);
+    total += c[0] * y[base * stride] + c[1] * y[(base + 1) * stride] + 
+      c[2] * y[(base + 2) * stride];
+    out[(i + 1) * stride] = total;
+  }
+}
+
+// cumtrapz() function
+// --------------------
+Napi::Value NativeModule::cumtrapz(const Napi::CallbackInfo& info) {
+  Napi::Env env = info.Env();
+
+  // Ensure at least one argument is provided
+  if(info.Length() < 1) {
+    Napi::TypeError::New(env, "cumtrapz expects at least one argument").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+
+  std::vector<double> y_buffer, x_buffer;
+  const double* y = nullptr;
+  const double* x = nullptr;
+  size_t n = 0, nx = 0;
+  if(!readNumbers(env, info[0], "y", y_buffer, y, n)) {
+    return env.Null();
+  }
+
+  // If x is provided, its length must match y
+  bool hasX = info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull();
+  if(hasX) {
+    if(!readNumbers(env, info[1], "x", x_buffer, x, nx)) {
+      return env.Null();
+    }
+    if(nx != n) {
+      Napi::RangeError::New(env, "x and y arrays must have the same length").ThrowAsJavaScriptException();
+      return env.Null();
+    }
+  }
 
-  // Cumulative trapezoidal integration
-  for(uint32_t i = 1; i < n; ++i) {
-    double dx = x[i] - x[i - 1];  // Difference in x
-    double dy = 0.5 * (y[i] + y[i - 1]);  // Average height (trapezoid rule)
-    result[i] = result[i - 1] + dx * dy;
+  // Typed input gives typed output, optionally written to provided array
+  if(info[0].IsTypedArray()) {
+    Napi::Float64Array jsResult;
+    if(info.Length() > 2 && info[2].IsTypedArray() && 
+        info[2].As<Napi::TypedArray>().TypedArrayType() == napi_float64_array) {
+      jsResult = info[2].As<Napi::Float64Array>();
+      if(jsResult.ElementLength() < n) {
+        Napi::RangeError::New(env, "Output array is too short").ThrowAsJavaScriptException();
+        return env.Null();
+      }
+    } else {
+      jsResult = Napi::Float64Array::New(env, n);
+    }
+    cumtrapzKernel(y, x, n, jsResult.Data(), 1);
+    return jsResult;
   }
 
-  // Convert Eigen vector back to JavaScript array
+  std::vector<double> result(n);
+  cumtrapzKernel(y, x, n, result.data(), 1);
   Napi::Array jsResult = Napi::Array::New(env, n);
   for(uint32_t i = 0; i < n; ++i) {
     jsResult.Set(i, Napi::Number::New(env, result[i]));
   }
-
   return jsResult;
 }
 
@@ -258,32 +568,24 @@ Napi::Value NativeModule::trapz(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  // Ensure the first argument is an array
-  if(!info[0].IsArray()) {
-    Napi::TypeError::New(env, "First argument must be an array").ThrowAsJavaScriptException();
+  std::vector<double> y_buffer, x_buffer;
+  const double* y = nullptr;
+  const double* x = nullptr;
+  size_t n = 0, nx = 0;
+  if(!readNumbers(env, info[0], "y", y_buffer, y, n)) {
     return env.Null();
   }
 
-  Napi::Array yInput = info[0].As<Napi::Array>();
-  Napi::Array xInput;
-  bool hasX = info.Length() > 1;
-
-  // If x is provided, ensure it's an array
+  // If x is provided, its length must match y
+  bool hasX = info.Length() > 1 && !info[1].IsUndefined() && !info[1].IsNull();
   if(hasX) {
-    if(!info[1].IsArray()) {
-      Napi::TypeError::New(env, "Second argument must be an array").ThrowAsJavaScriptException();
+    if(!readNumbers(env, info[1], "x", x_buffer, x, nx)) {
+      return env.Null();
+    }
+    if(nx != n) {
+      Napi::RangeError::New(env, "x and y arrays must have the same length").ThrowAsJavaScriptException();
       return env.Null();
     }
-    xInput = info[1].As<Napi::Array>();
-  }
-
-  // Get the length of yInput
-  uint32_t n = yInput.Length();
-
-  // If x is provided, its length must match yInput
-  if(hasX && xInput.Length() != n) {
-    Napi::RangeError::New(env, "x and y arrays must have the same length").ThrowAsJavaScriptException();
-    return env.Null();
   }
 
   // Handle cases with fewer than 2 points
@@ -292,46 +594,141 @@ Napi::Value NativeModule::trapz(const Napi::CallbackInfo& info) {
     return env.Null();
   }
 
-  // Initialize Eigen vectors
-  Eigen::VectorXd y(n);
-  Eigen::VectorXd x(n);
+  return Napi::Number::New(env, trapzKernel(y, x, n));
+}
 
-  // Load y values from JavaScript array
-  for(uint32_t i = 0; i < n; ++i) {
-    Napi::Value val = yInput.Get(i);
-    if(!val.IsNumber()) {
-      Napi::TypeError::New(env, "y array must contain only numbers").ThrowAsJavaScriptException();
+// integrateMatrix() function
+// Integrates column-major matrix along dimension 0 (each column) or 
+// dimension 1 (each row), columns or row blocks are processed in parallel.
+// Arguments are (Y, rows, cols, x, dim).
+// --------------------
+Napi::Value NativeModule::integrateMatrix(const Napi::CallbackInfo& info, 
+    bool simpson, bool cumulative) {
+  Napi::Env env = info.Env();
+
+  if(info.Length() < 3 || !info[0].IsTypedArray() || 
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array ||
+      !info[1].IsNumber() || !info[2].IsNumber()) {
+    Napi::TypeError::New(env, "Expected Float64Array, rows and cols").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  Napi::Float64Array jsY = info[0].As<Napi::Float64Array>();
+  size_t rows = info[1].As<Napi::Number>().Uint32Value();
+  size_t cols = info[2].As<Napi::Number>().Uint32Value();
+  if(jsY.ElementLength() != rows * cols) {
+    Napi::RangeError::New(env, "Matrix data length must be rows*cols").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  uint32_t dim = 0;
+  if(info.Length() > 4 && info[4].IsNumber()) {
+    dim = info[4].As<Napi::Number>().Uint32Value();
+  }
+  if(dim > 1) {
+    Napi::RangeError::New(env, "Dimension must be 0 or 1").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  size_t n = dim == 0 ? rows : cols;
+  size_t m = dim == 0 ? cols : rows;
+
+  std::vector<double> x_buffer;
+  const double* x = nullptr;
+  if(info.Length() > 3 && !info[3].IsUndefined() && !info[3].IsNull()) {
+    size_t nx = 0;
+    if(!readNumbers(env, info[3], "x", x_buffer, x, nx)) {
+      return env.Null();
+    }
+    if(nx != n) {
+      Napi::RangeError::New(env, "Length of x must match the integration dimension").ThrowAsJavaScriptException();
       return env.Null();
     }
-    y[i] = val.As<Napi::Number>().DoubleValue();
   }
 
-  // If x is provided, load x values; otherwise, assume uniform spacing
-  if(hasX) {
-    for(uint32_t i = 0; i < n; ++i) {
-      Napi::Value val = xInput.Get(i);
-      if (!val.IsNumber()) {
-        Napi::TypeError::New(env, "x array must contain only numbers").ThrowAsJavaScriptException();
-        return env.Null();
-      }
-      x[i] = val.As<Napi::Number>().DoubleValue();
-    }
-  } else {
-    // Uniform spacing: x = [0, 1, 2, ..., n-1]
-    for(uint32_t i = 0; i < n; ++i) {
-      x[i] = static_cast<double>(i);
+  const double* Y = jsY.Data();
+  const size_t block = 256;
+  if(cumulative) {
+    Napi::Float64Array jsResult = Napi::Float64Array::New(env, rows * cols);
+    double* out = jsResult.Data();
+    if(dim == 0) {
+      parallelFor(cols, [&](size_t j) {
+        if(simpson) {
+          cumsimpsonKernel(Y + j * rows, x, rows, out + j * rows, 1);
+        } else {
+          cumtrapzKernel(Y + j * rows, x, rows, out + j * rows, 1);
+        }
+      });
+    } else {
+      // Row blocks keep access along contiguous columns
+      parallelFor((rows + block - 1) / block, [&](size_t b) {
+        size_t r0 = b * block;
+        size_t r1 = (std::min)(rows, r0 + block);
+        for(size_t i = r0; i < r1; ++i) {
+          out[i] = 0.0;
+        }
+        for(size_t j = 0; j + 1 < cols; ++j) {
+          size_t base = j;
+          double c[3] = {0.5, 0.5, 0.0};
+          if(simpson && cols >= 3) {
+            simpsonInterval(x, cols, j, base, c);
+          } else if(x) {
+            c[0] = c[1] = 0.5 * (x[j + 1] - x[j]);
+          }
+          const double* y0 = Y + base * rows;
+          const double* y1 = y0 + rows;
+          const double* y2 = (c[2] != 0.0) ? y1 + rows : y1;
+          const double* prev = out + j * rows;
+          double* next = out + (j + 1) * rows;
+          for(size_t i = r0; i < r1; ++i) {
+            next[i] = prev[i] + c[0] * y0[i] + c[1] * y1[i] + c[2] * y2[i];
+          }
+        }
+      });
     }
+    return jsResult;
   }
 
-  // Perform trapezoidal integration
-  double total = 0.0;
-  for(uint32_t i = 1; i < n; ++i) {
-    double dx = x[i] - x[i - 1];
-    double dy = 0.5 * (y[i] + y[i - 1]);
-    total += dx * dy;
+  std::vector<double> w(n);
+  integrationWeights(x, n, simpson, w.data());
+  Map<const VectorXd> W(w.data(), n);
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, m);
+  double* out = jsResult.Data();
+  if(dim == 0) {
+    parallelFor(cols, [&](size_t j) {
+      out[j] = Map<const VectorXd>(Y + j * rows, rows).dot(W);
+    });
+  } else {
+    parallelFor((rows + block - 1) / block, [&](size_t b) {
+      size_t r0 = b * block;
+      size_t nr = (std::min)(rows, r0 + block) - r0;
+      Map<VectorXd> O(out + r0, nr);
+      Map<const MatrixXd, 0, OuterStride<>> Yb(Y + r0, nr, cols, OuterStride<>(rows));
+      O.noalias() = Yb * W;
+    });
   }
+  return jsResult;
+}
 
-  return Napi::Number::New(env, total);
+// trapzMatrix() function
+// --------------------
+Napi::Value NativeModule::trapzMatrix(const Napi::CallbackInfo& info) {
+  return this->integrateMatrix(info, false, false);
+}
+
+// cumtrapzMatrix() function
+// --------------------
+Napi::Value NativeModule::cumtrapzMatrix(const Napi::CallbackInfo& info) {
+  return this->integrateMatrix(info, false, true);
+}
+
+// simpsonMatrix() function
+// --------------------
+Napi::Value NativeModule::simpsonMatrix(const Napi::CallbackInfo& info) {
+  return this->integrateMatrix(info, true, false);
+}
+
+// cumsimpsonMatrix() function
+// --------------------
+Napi::Value NativeModule::cumsimpsonMatrix(const Napi::CallbackInfo& info) {
+  return this->integrateMatrix(info, true, true);
 }
 
 // listSubprocesses() function
@@ -382,7 +779,17 @@ Napi::Value NativeModule::listSubprocesses(const Napi::CallbackInfo& info) {
 }
 
 Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
-  return NativeModule::Init(env, exports);
+  env.SetInstanceData(new AddonData());
+  exports = NativeModule::Init(env, exports);
+  env.GetInstanceData<AddonData>()->denseFactorization = 
+    Napi::Persistent(DenseFactorization::Init(env));
+  env.GetInstanceData<AddonData>()->nativeSparseMatrix = 
+    Napi::Persistent(NativeSparseMatrix::Init(env));
+  env.GetInstanceData<AddonData>()->randomGenerator = 
+    Napi::Persistent(RandomGenerator::Init(env));
+  env.GetInstanceData<AddonData>()->nativeArray = 
+    Napi::Persistent(NativeArray::Init(env));
+  return exports;
 }
 
 NODE_API_MODULE(NODE_GYP_MODULE_NAME, InitAll)
@@ -25,13 +25,131 @@
 #include <filesystem>
 #include <vector>
 #include <complex>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <map>
+#include <set>
+#include <deque>
+#include <numeric>
+#include <cstring>
 #include <Eigen/Dense>
+#include <Eigen/Sparse>
+#include <unsupported/Eigen/MatrixFunctions>
+
+#include "native-utils.h"
 
 namespace native_module_ns {
 
 using namespace std;
 using namespace std::chrono;
 using namespace Eigen;
+using namespace native_utils_ns;
+
+// Constructors of classes exported by the addon
+struct AddonData {
+  Napi::FunctionReference nativeModule;
+  Napi::FunctionReference denseFactorization;
+  Napi::FunctionReference nativeSparseMatrix;
+  Napi::FunctionReference randomGenerator;
+  Napi::FunctionReference nativeArray;
+};
+
+typedef SparseMatrix<double> SpMat;
+
+// Cached FFT plan, Bluestein plans use transform of size m over sub plan
+struct FFTPlan {
+  size_t n = 0;
+  std::vector<size_t> factors;
+  std::vector<std::complex<double>> twiddles;
+  size_t m = 0;
+  std::vector<std::complex<double>> chirp;
+  std::vector<std::complex<double>> filter;
+  std::shared_ptr<const FFTPlan> sub;
+};
+
+// Interpolation methods and extrapolation modes
+enum InterpMethod {INTERP_LINEAR, INTERP_NEAREST, INTERP_PREVIOUS, 
+  INTERP_NEXT, INTERP_PCHIP, INTERP_SPLINE};
+enum InterpExtrap {INTERP_EXTRAP_FILL, INTERP_EXTRAP, INTERP_EXTRAP_CLAMP};
+
+// Moving window statistics
+enum MovStat {MOVSTAT_SUM, MOVSTAT_MEAN, MOVSTAT_VAR, MOVSTAT_STD, 
+  MOVSTAT_MIN, MOVSTAT_MAX, MOVSTAT_MEDIAN};
+
+// Running moments of data, central sums up to fourth order
+struct Moments {
+  double n = 0;
+  double mean = 0;
+  double M2 = 0;
+  double M3 = 0;
+  double M4 = 0;
+  double min = std::numeric_limits<double>::infinity();
+  double max = -std::numeric_limits<double>::infinity();
+  double nans = 0;
+};
+
+// Distributions of random generator
+enum RandomDistribution {RANDOM_UNIFORM, RANDOM_NORMAL, RANDOM_INTEGER};
+
+// Shared helpers
+bool readNumbers(Napi::Env env, const Napi::Value& value, const char* name, 
+  std::vector<double>& buffer, const double*& data, size_t& n);
+bool readMatrix(Napi::Env env, const Napi::Value& value, const char* name, 
+  size_t rows, size_t cols, std::vector<double>& buffer, const double*& data);
+bool readDimensions(const Napi::CallbackInfo& info, size_t first, size_t count, 
+  const char* name, size_t* dims);
+
+// Numerical kernels
+void companionRoots(const double* c, int degree, std::complex<double>* roots);
+void aberthRoots(const double* c, int degree, std::complex<double>* roots);
+double trapzKernel(const double* y, const double* x, size_t n);
+void cumtrapzKernel(const double* y, const double* x, size_t n, double* out,
+  size_t stride);
+void cumsimpsonKernel(const double* y, const double* x, size_t n, double* out,
+  size_t stride);
+void integrationWeights(const double* x, size_t n, bool simpson, double* w);
+bool c2dKernel(const MatrixXd& A, const MatrixXd& B, const MatrixXd& C, 
+  const MatrixXd& D, double Ts, const std::string& method, 
+  MatrixXd& Ad, MatrixXd& Bd, MatrixXd& Cd, MatrixXd& Dd);
+bool lsimKernel(const double* num, size_t nb, const double* den, size_t na, 
+  const double* u, size_t N, double* y);
+VectorXd charpolyKernel(const MatrixXd& A);
+void interpSlopes(const double* x, const double* y, size_t n, int method, 
+  double* d);
+void interp1Kernel(const double* x, const double* y, const double* d, size_t n, 
+  int method, int extrap, double fill, const double* xq, size_t m, 
+  double* out);
+void polyVandermonde(const double* x, size_t m, int n, const double* mu,
+  MatrixXd& V);
+void polyvalKernel(const double* p, size_t np, const double* x, size_t m,
+  const double* mu, double* y);
+std::shared_ptr<const FFTPlan> fftPlan(size_t n);
+void fftKernel(const FFTPlan& plan, const std::complex<double>* in, 
+  std::complex<double>* out, bool inverse, bool parallel);
+void rfftKernel(const double* x, size_t n, std::complex<double>* out, 
+  bool parallel);
+void irfftKernel(const std::complex<double>* X, size_t nh, size_t n, 
+  double* out, bool parallel);
+void filterKernel(const double* b, const double* a, size_t L,
+  const double* x, size_t N, double* z, double* y);
+void convColumns(const double* u, size_t n, size_t channels, const double* v,
+  size_t m, double* out);
+void movstatKernel(const double* x, size_t N, size_t kb, size_t kf, int stat,
+  double* y);
+Moments momentsKernel(const double* x, size_t N, bool parallel);
+uint64_t sortKey(double v, bool descending);
+void sortIndexKernel(uint64_t* keys, uint32_t* idx, size_t n, bool parallel);
+void argsortKernel(const double* K, size_t n, size_t nkeys,
+  const std::vector<bool>& descending, uint32_t* perm);
+void prctileKernel(const double* x, size_t N, const double* p, size_t np,
+  double* y);
+VectorXd singularValues(const double* a, size_t rows, size_t cols);
+double svdTolerance(const VectorXd& S, size_t rows, size_t cols);
 
 class NativeModule : public Napi::ObjectWrap<NativeModule> {
  public:
@@ -40,9 +158,205 @@ class NativeModule : public Napi::ObjectWrap<NativeModule> {
   ~NativeModule();
  
   Napi::Value roots(const Napi::CallbackInfo& info);
+  Napi::Value rootsBatch(const Napi::CallbackInfo& info);
   Napi::Value cumtrapz(const Napi::CallbackInfo& info);
   Napi::Value trapz(const Napi::CallbackInfo& info);
+  Napi::Value trapzMatrix(const Napi::CallbackInfo& info);
+  Napi::Value cumtrapzMatrix(const Napi::CallbackInfo& info);
+  Napi::Value simpsonMatrix(const Napi::CallbackInfo& info);
+  Napi::Value cumsimpsonMatrix(const Napi::CallbackInfo& info);
   Napi::Value listSubprocesses(const Napi::CallbackInfo& info);
+
+  // Linear algebra
+  Napi::Value matmul(const Napi::CallbackInfo& info);
+  Napi::Value factorize(const Napi::CallbackInfo& info);
+  Napi::Value inv(const Napi::CallbackInfo& info);
+  Napi::Value det(const Napi::CallbackInfo& info);
+  Napi::Value linsolve(const Napi::CallbackInfo& info);
+  Napi::Value eig(const Napi::CallbackInfo& info);
+  Napi::Value svd(const Napi::CallbackInfo& info);
+  Napi::Value pinv(const Napi::CallbackInfo& info);
+  Napi::Value rank(const Napi::CallbackInfo& info);
+  Napi::Value cond(const Napi::CallbackInfo& info);
+  Napi::Value charpoly(const Napi::CallbackInfo& info);
+  Napi::Value expm(const Napi::CallbackInfo& info);
+
+  // Sparse matrices
+  Napi::Value sparse(const Napi::CallbackInfo& info);
+
+  // Control systems
+  Napi::Value c2d(const Napi::CallbackInfo& info);
+  Napi::Value lsim(const Napi::CallbackInfo& info);
+  Napi::Value lsimBatch(const Napi::CallbackInfo& info);
+  Napi::Value lsimSS(const Napi::CallbackInfo& info);
+  Napi::Value tfest(const Napi::CallbackInfo& info);
+
+  // Interpolation
+  Napi::Value interp1(const Napi::CallbackInfo& info);
+
+  // Polynomials
+  Napi::Value polyfit(const Napi::CallbackInfo& info);
+  Napi::Value polyfitBatch(const Napi::CallbackInfo& info);
+  Napi::Value polyval(const Napi::CallbackInfo& info);
+  Napi::Value polyvalBatch(const Napi::CallbackInfo& info);
+
+  // Spectral analysis
+  Napi::Value fft(const Napi::CallbackInfo& info);
+  Napi::Value fft2(const Napi::CallbackInfo& info);
+  Napi::Value rfft(const Napi::CallbackInfo& info);
+  Napi::Value irfft(const Napi::CallbackInfo& info);
+  Napi::Value stft(const Napi::CallbackInfo& info);
+  Napi::Value pwelch(const Napi::CallbackInfo& info);
+
+  // Digital filtering
+  Napi::Value filter(const Napi::CallbackInfo& info);
+  Napi::Value filtfilt(const Napi::CallbackInfo& info);
+  Napi::Value conv(const Napi::CallbackInfo& info);
+  Napi::Value deconv(const Napi::CallbackInfo& info);
+  Napi::Value decimate(const Napi::CallbackInfo& info);
+  Napi::Value resample(const Napi::CallbackInfo& info);
+
+  // Statistics
+  Napi::Value movstat(const Napi::CallbackInfo& info);
+  Napi::Value describe(const Napi::CallbackInfo& info);
+  Napi::Value histcounts(const Napi::CallbackInfo& info);
+
+  // Sorting
+  Napi::Value sort(const Napi::CallbackInfo& info);
+  Napi::Value argsort(const Napi::CallbackInfo& info);
+  Napi::Value prctile(const Napi::CallbackInfo& info);
+
+  // Random numbers
+  Napi::Value rng(const Napi::CallbackInfo& info);
+
+  // Strided arrays
+  Napi::Value ndarray(const Napi::CallbackInfo& info);
+
+ private:
+  Napi::Value integrateMatrix(const Napi::CallbackInfo& info, bool simpson, 
+    bool cumulative);
+};
+
+class DenseFactorization : public Napi::ObjectWrap<DenseFactorization> {
+ public:
+  static Napi::Function Init(Napi::Env env);
+  DenseFactorization(const Napi::CallbackInfo& info);
+  ~DenseFactorization();
+
+  bool factorize(Napi::Env env, const double* A, size_t rows, size_t cols, 
+    const std::string& type);
+  void solve(const double* B, size_t nrhs, double* X);
+  void inverse(double* X);
+  double determinant(void);
+
+  // JavaScript wrapper methods
+  Napi::Value SolveJS(const Napi::CallbackInfo& info);
+  Napi::Value InverseJS(const Napi::CallbackInfo& info);
+  Napi::Value DeterminantJS(const Napi::CallbackInfo& info);
+  Napi::Value RankJS(const Napi::CallbackInfo& info);
+  Napi::Value RcondJS(const Napi::CallbackInfo& info);
+  Napi::Value GetTypeJS(const Napi::CallbackInfo& info);
+  Napi::Value GetSizeJS(const Napi::CallbackInfo& info);
+
+ private:
+  std::string type;
+  size_t rows;
+  size_t cols;
+  PartialPivLU<MatrixXd> lu;
+  ColPivHouseholderQR<MatrixXd> qr;
+  LLT<MatrixXd> llt;
+  LDLT<MatrixXd> ldlt;
+};
+
+class NativeSparseMatrix : public Napi::ObjectWrap<NativeSparseMatrix> {
+ public:
+  static Napi::Function Init(Napi::Env env);
+  NativeSparseMatrix(const Napi::CallbackInfo& info);
+  ~NativeSparseMatrix();
+
+  bool solve(Napi::Env env, const double* B, size_t nrhs, double* X, 
+    const std::string& method, double tol, int max_iterations);
+
+  // JavaScript wrapper methods
+  Napi::Value MultiplyJS(const Napi::CallbackInfo& info);
+  Napi::Value SolveJS(const Napi::CallbackInfo& info);
+  Napi::Value GetSolverInfoJS(const Napi::CallbackInfo& info);
+  Napi::Value GetSizeJS(const Napi::CallbackInfo& info);
+  Napi::Value NnzJS(const Napi::CallbackInfo& info);
+  Napi::Value ToDenseJS(const Napi::CallbackInfo& info);
+  Napi::Value GetTripletsJS(const Napi::CallbackInfo& info);
+
+ private:
+  SpMat matrix;
+  std::unique_ptr<SimplicialLDLT<SpMat>> ldlt;
+  std::unique_ptr<SparseLU<SpMat>> lu;
+  Index lastIterations;
+  double lastError;
+};
+
+class RandomGenerator : public Napi::ObjectWrap<RandomGenerator> {
+ public:
+  static Napi::Function Init(Napi::Env env);
+  RandomGenerator(const Napi::CallbackInfo& info);
+  ~RandomGenerator();
+
+  void generate(int distribution, double p1, double p2, size_t n, double* y,
+    int32_t* yi);
+
+  // JavaScript wrapper methods
+  Napi::Value RandJS(const Napi::CallbackInfo& info);
+  Napi::Value RandnJS(const Napi::CallbackInfo& info);
+  Napi::Value RandiJS(const Napi::CallbackInfo& info);
+  Napi::Value FillJS(const Napi::CallbackInfo& info);
+  Napi::Value NextJS(const Napi::CallbackInfo& info);
+  Napi::Value GetAlgorithmJS(const Napi::CallbackInfo& info);
+
+ private:
+  bool philox;
+  uint32_t key[2];
+  uint32_t stream;
+  uint64_t position;
+  uint64_t state[4];
+};
+
+class NativeArray : public Napi::ObjectWrap<NativeArray> {
+ public:
+  static Napi::Function Init(Napi::Env env);
+  static Napi::Value create(Napi::Env env, Napi::Float64Array data,
+    const std::vector<size_t>& shape, const std::vector<ptrdiff_t>& strides,
+    size_t offset);
+  NativeArray(const Napi::CallbackInfo& info);
+  ~NativeArray();
+
+  size_t numel() const;
+  bool isContiguous() const;
+  bool isDisjoint() const;
+  double* data();
+  ptrdiff_t elementOffset(size_t k) const;
+  bool overlaps(const double* p, size_t n);
+  void copyTo(double* out);
+
+  // JavaScript wrapper methods
+  Napi::Value GetShapeJS(const Napi::CallbackInfo& info);
+  Napi::Value GetStridesJS(const Napi::CallbackInfo& info);
+  Napi::Value GetOffsetJS(const Napi::CallbackInfo& info);
+  Napi::Value IsContiguousJS(const Napi::CallbackInfo& info);
+  Napi::Value BufferJS(const Napi::CallbackInfo& info);
+  Napi::Value ToFloat64ArrayJS(const Napi::CallbackInfo& info);
+  Napi::Value CopyJS(const Napi::CallbackInfo& info);
+  Napi::Value ViewJS(const Napi::CallbackInfo& info);
+  Napi::Value PermuteJS(const Napi::CallbackInfo& info);
+  Napi::Value ReshapeJS(const Napi::CallbackInfo& info);
+  Napi::Value GatherJS(const Napi::CallbackInfo& info);
+  Napi::Value ScatterJS(const Napi::CallbackInfo& info);
+  Napi::Value ApplyJS(const Napi::CallbackInfo& info);
+  Napi::Value MapJS(const Napi::CallbackInfo& info);
+
+ private:
+  Napi::Reference<Napi::Float64Array> buffer;
+  std::vector<size_t> shape;
+  std::vector<ptrdiff_t> strides;
+  size_t offset;
 };
 
 }// namespace native_module_ns
@@ -0,0 +1,101 @@
+// JSLAB - native-utils.h
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#ifndef NATIVE_UTILS_H
+#define NATIVE_UTILS_H
+
+#include <chrono>
+#include <thread>
+#include <ctime>
+#include <cstdio>
+#include <cstdarg>
+#include <cstdint>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <algorithm>
+
+namespace native_utils_ns {
+
+// Function to get current time
+inline std::string getCurrentTime() {
+  using namespace std::chrono;
+
+  // get current time
+  auto now = system_clock::now();
+
+  // get number of milliseconds for the current second
+  // (remainder after division into seconds)
+  auto ms = duration_cast<milliseconds>(now.time_since_epoch()) % 1000;
+
+  // convert to std::time_t in order to convert to std::tm (broken time)
+  auto timer = system_clock::to_time_t(now);
+
+  // convert to broken time
+  std::tm bt = *std::localtime(&timer);
+
+  std::ostringstream oss;
+
+  oss << std::put_time(&bt, "%H:%M:%S"); // HH:MM:SS
+  oss << '.' << std::setfill('0') << std::setw(3) << ms.count();
+
+  return oss.str();
+}
+
+// Function to console log data with module name, level is checked by caller
+inline int consoleLogV(const char* name, const char* format, va_list vl) {
+  printf("\033[0;33m[%s %s]\033[0m ", getCurrentTime().c_str(), name);
+  auto ret = vprintf(format, vl);
+  printf("\n");
+  return ret;
+}
+
+// Function to run loop iterations on all available hardware threads
+inline void parallelFor(size_t n, const std::function<void(size_t)>& fun) {
+  size_t num_threads = (std::min)(n,
+    (size_t)(std::max)(1u, std::thread::hardware_concurrency()));
+  if(num_threads <= 1) {
+    for(size_t i = 0; i < n; i++) {
+      fun(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next(0);
+  std::exception_ptr error = nullptr;
+  std::mutex error_mutex;
+  std::vector<std::thread> threads;
+  for(size_t t = 0; t < num_threads; t++) {
+    threads.emplace_back([&]() {
+      try {
+        for(size_t i = next++; i < n; i = next++) {
+          fun(i);
+        }
+      } catch(...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if(!error) {
+          error = std::current_exception();
+        }
+        next = n;
+      }
+    });
+  }
+  for(std::thread& thread : threads) {
+    thread.join();
+  }
+  if(error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}// namespace native_utils_ns
+
+#endif // NATIVE_UTILS_H
\ No newline at end of file
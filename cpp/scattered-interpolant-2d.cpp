@@ -0,0 +1,670 @@
+// ScatteredInterpolant2D - scattered-interpolant-2d.cpp
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#include "scattered-interpolant-2d.h"
+
+namespace scattered_interpolant_2d_ns {
+
+// Function to console log data
+int consoleLog(uint8_t level, const char* format, ...) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D_LEVEL
+  if(level <= DEBUG_SCATTERED_INTERPOLANT_2D_LEVEL) {
+    va_list vl;
+    va_start(vl, format);
+    auto ret = consoleLogV("ScatteredInterpolant2D", format, vl);
+    va_end(vl);
+    return ret;
+  }
+#endif
+  return 0;
+}
+
+// fitGradient() function
+// Weighted least squares fit of gradient from differences to neighbors,
+// quadratic terms are included when there are enough neighbors
+// --------------------
+bool fitGradient(const double* dx, const double* dy, const double* dz,
+    std::size_t k, double* g) {
+  int cols = k >= 5 ? 5 : 2;
+  if(k < 2){
+    g[0] = 0;
+    g[1] = 0;
+    return false;
+  }
+  Eigen::MatrixXd A(k, cols);
+  Eigen::VectorXd b(k);
+  for(std::size_t i = 0; i < k; i++){
+    double w = 1 / (dx[i] * dx[i] + dy[i] * dy[i]);
+    A(i, 0) = w * dx[i];
+    A(i, 1) = w * dy[i];
+    if(cols == 5){
+      A(i, 2) = w * dx[i] * dx[i];
+      A(i, 3) = w * dx[i] * dy[i];
+      A(i, 4) = w * dy[i] * dy[i];
+    }
+    b(i) = w * dz[i];
+  }
+  Eigen::VectorXd c = A.colPivHouseholderQr().solve(b);
+  g[0] = c(0);
+  g[1] = c(1);
+  return std::isfinite(g[0]) && std::isfinite(g[1]);
+}
+
+// cloughTocher() function
+// Cubic C1 interpolant on triangle split at centroid, control points of
+// Bezier patches follow from values and gradients at vertices with
+// linear cross-boundary derivative along edges, b are barycentric
+// coordinates of query point
+// --------------------
+double cloughTocher(const double* x, const double* y, const double* f,
+    const double* gx, const double* gy, const double* b) {
+  auto dd = [&](int i, int j) {
+    return (gx[i] * (x[j] - x[i]) + gy[i] * (y[j] - y[i])) / 3;
+  };
+  double c3000 = f[0], c0300 = f[1], c0030 = f[2];
+  double c2100 = f[0] + dd(0, 1), c2010 = f[0] + dd(0, 2);
+  double c1200 = f[1] + dd(1, 0), c0210 = f[1] + dd(1, 2);
+  double c1020 = f[2] + dd(2, 0), c0120 = f[2] + dd(2, 1);
+  double c2001 = (c3000 + c2100 + c2010) / 3;
+  double c0201 = (c0300 + c1200 + c0210) / 3;
+  double c0021 = (c0030 + c0120 + c1020) / 3;
+
+  double cx = (x[0] + x[1] + x[2]) / 3, cy = (y[0] + y[1] + y[2]) / 3;
+  auto edge = [&](int i, int j, double b300, double b210, double b120,
+      double b030, double b201, double b021) {
+    double ex = x[j] - x[i], ey = y[j] - y[i];
+    double alpha = ((cx - (x[i] + x[j]) / 2) * ex +
+      (cy - (y[i] + y[j]) / 2) * ey) / (ex * ex + ey * ey);
+    double q0 = b201 - (b300 + b210) / 2;
+    double q2 = b021 - (b120 + b030) / 2;
+    double q1 = (q0 + q2) / 2 + alpha * (1.5 * (b120 - b210) + (b300 - b030) / 2);
+    return q1 + (b210 + b120) / 2;
+  };
+  double c1101 = edge(0, 1, c3000, c2100, c1200, c0300, c2001, c0201);
+  double c0111 = edge(1, 2, c0300, c0210, c0120, c0030, c0201, c0021);
+  double c1011 = edge(2, 0, c0030, c1020, c2010, c3000, c0021, c2001);
+  double c1002 = (c1101 + c1011 + c2001) / 3;
+  double c0102 = (c1101 + c0111 + c0201) / 3;
+  double c0012 = (c1011 + c0111 + c0021) / 3;
+  double c0003 = (c1002 + c0102 + c0012) / 3;
+
+  // Sub-triangle opposite to the smallest barycentric coordinate
+  double u, v, w;
+  double b300, b030, b210, b120, b201, b021, b111, b102, b012;
+  if(b[2] <= b[0] && b[2] <= b[1]){
+    u = b[0] - b[2]; v = b[1] - b[2]; w = 3 * b[2];
+    b300 = c3000; b030 = c0300; b210 = c2100; b120 = c1200;
+    b201 = c2001; b021 = c0201; b111 = c1101; b102 = c1002; b012 = c0102;
+  } else if(b[0] <= b[1]){
+    u = b[1] - b[0]; v = b[2] - b[0]; w = 3 * b[0];
+    b300 = c0300; b030 = c0030; b210 = c0210; b120 = c0120;
+    b201 = c0201; b021 = c0021; b111 = c0111; b102 = c0102; b012 = c0012;
+  } else {
+    u = b[2] - b[1]; v = b[0] - b[1]; w = 3 * b[1];
+    b300 = c0030; b030 = c3000; b210 = c1020; b120 = c2010;
+    b201 = c0021; b021 = c2001; b111 = c1011; b102 = c0012; b012 = c1002;
+  }
+  return u * u * u * b300 + v * v * v * b030 + w * w * w * c0003 +
+    3 * (u * u * v * b210 + u * v * v * b120 + u * u * w * b201 +
+    v * v * w * b021 + u * w * w * b102 + v * w * w * b012) +
+    6 * u * v * w * b111;
+}
+
+// ScatteredInterpolant2D()
+// Object constructor
+// --------------------
+ScatteredInterpolant2D::ScatteredInterpolant2D(const Napi::CallbackInfo& info) :
+    Napi::ObjectWrap<ScatteredInterpolant2D>(info) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called constructor");
+#endif
+  this->delaunayTriangulation = nullptr;
+  this->tree = nullptr;
+}
+
+// ~ScatteredInterpolant2D()
+// Object destructor
+// --------------------
+ScatteredInterpolant2D::~ScatteredInterpolant2D(void) {
+  if(this->tree){
+    delete this->tree;
+    this->tree = nullptr;
+  }
+  if(this->delaunayTriangulation){
+    delete this->delaunayTriangulation;
+    this->delaunayTriangulation = nullptr;
+  }
+}
+
+// Init() function
+// --------------------
+Napi::Object ScatteredInterpolant2D::Init(Napi::Env env, Napi::Object exports) {
+  Napi::Function func = DefineClass(env, "ScatteredInterpolant2D", {
+    InstanceMethod("newData", &ScatteredInterpolant2D::NewDataJS),
+    InstanceMethod("setValues", &ScatteredInterpolant2D::SetValuesJS),
+    InstanceMethod("interpolate", &ScatteredInterpolant2D::InterpolateJS),
+    InstanceMethod("interpolateGrid", &ScatteredInterpolant2D::InterpolateGridJS)
+  });
+  Napi::FunctionReference* constructor = new Napi::FunctionReference();
+  *constructor = Napi::Persistent(func);
+  env.SetInstanceData(constructor);
+
+  exports.Set("ScatteredInterpolant2D", func);
+  return exports;
+}
+
+// hasData() function
+// --------------------
+bool ScatteredInterpolant2D::hasData(Napi::Env env) {
+  if(!this->delaunayTriangulation){
+    Napi::Error::New(env, "Data is not set, call newData first").ThrowAsJavaScriptException();
+    return false;
+  }
+  return true;
+}
+
+// readOptions() function
+// Reads method name and extrapolation flag
+// --------------------
+bool ScatteredInterpolant2D::readOptions(const Napi::CallbackInfo& info,
+    std::size_t first, int& method, bool& extrap) {
+  Napi::Env env = info.Env();
+  method = METHOD_LINEAR;
+  extrap = false;
+  if(info.Length() > first && info[first].IsString()){
+    std::string name = info[first].As<Napi::String>().Utf8Value();
+    if(name == "linear"){
+      method = METHOD_LINEAR;
+    } else if(name == "nearest"){
+      method = METHOD_NEAREST;
+    } else if(name == "natural"){
+      method = METHOD_NATURAL;
+    } else if(name == "cubic"){
+      method = METHOD_CUBIC;
+    } else {
+      Napi::TypeError::New(env, "Method must be 'linear', 'nearest', 'natural' or 'cubic'").ThrowAsJavaScriptException();
+      return false;
+    }
+  }
+  if(info.Length() > first + 1){
+    extrap = info[first + 1].ToBoolean();
+  }
+  return true;
+}
+
+// NewDataJS() function
+// --------------------
+void ScatteredInterpolant2D::NewDataJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called NewDataJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 2 || !info[0].IsTypedArray() || !info[1].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array ||
+      info[1].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of points [x0, y0, x1, y1, ...] and Float64Array of values expected").ThrowAsJavaScriptException();
+    return;
+  }
+
+  Napi::Float64Array jsPoints = info[0].As<Napi::Float64Array>();
+  Napi::Float64Array jsValues = info[1].As<Napi::Float64Array>();
+  if(jsPoints.ElementLength() % 2 != 0){
+    Napi::RangeError::New(env, "Number of coordinates should be a multiple of 2").ThrowAsJavaScriptException();
+    return;
+  }
+  if(jsPoints.ElementLength() / 2 != jsValues.ElementLength()){
+    Napi::RangeError::New(env, "Number of values should match number of points").ThrowAsJavaScriptException();
+    return;
+  }
+  if(jsValues.ElementLength() < 1){
+    Napi::RangeError::New(env, "At least 1 point is required").ThrowAsJavaScriptException();
+    return;
+  }
+
+  this->newData(jsPoints.Data(), jsValues.Data(), jsValues.ElementLength());
+}
+
+// SetValuesJS() function
+// --------------------
+void ScatteredInterpolant2D::SetValuesJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called SetValuesJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of values expected").ThrowAsJavaScriptException();
+    return;
+  }
+  if(!this->hasData(env)){
+    return;
+  }
+  Napi::Float64Array jsValues = info[0].As<Napi::Float64Array>();
+  if(jsValues.ElementLength() != this->values.size()){
+    Napi::RangeError::New(env, "Number of values should match number of points").ThrowAsJavaScriptException();
+    return;
+  }
+  this->setValues(jsValues.Data());
+}
+
+// InterpolateJS() function
+// --------------------
+Napi::Value ScatteredInterpolant2D::InterpolateJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called InterpolateJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 1 || !info[0].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of query points [x0, y0, x1, y1, ...] expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  int method;
+  bool extrap;
+  if(!this->hasData(env) || !this->readOptions(info, 1, method, extrap)){
+    return env.Null();
+  }
+
+  Napi::Float64Array QP = info[0].As<Napi::Float64Array>();
+  std::size_t n = QP.ElementLength() / 2;
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env, n);
+  this->interpolate(QP.Data(), QP.Data() + 1, n, method, extrap, jsResult.Data());
+  return jsResult;
+}
+
+// InterpolateGridJS() function
+// --------------------
+Napi::Value ScatteredInterpolant2D::InterpolateGridJS(const Napi::CallbackInfo& info) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called InterpolateGridJS()");
+#endif
+
+  Napi::Env env = info.Env();
+  if(info.Length() < 2 || !info[0].IsTypedArray() || !info[1].IsTypedArray() ||
+      info[0].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array ||
+      info[1].As<Napi::TypedArray>().TypedArrayType() != napi_float64_array){
+    Napi::TypeError::New(env, "Float64Array of grid x and y coordinates expected").ThrowAsJavaScriptException();
+    return env.Null();
+  }
+  int method;
+  bool extrap;
+  if(!this->hasData(env) || !this->readOptions(info, 2, method, extrap)){
+    return env.Null();
+  }
+
+  Napi::Float64Array xq = info[0].As<Napi::Float64Array>();
+  Napi::Float64Array yq = info[1].As<Napi::Float64Array>();
+  Napi::Float64Array jsResult = Napi::Float64Array::New(env,
+    xq.ElementLength() * yq.ElementLength());
+  this->interpolateGrid(xq.Data(), xq.ElementLength(), yq.Data(),
+    yq.ElementLength(), method, extrap, jsResult.Data());
+  return jsResult;
+}
+
+// newData() function
+// Repeated points are merged into one vertex with mean of their values,
+// vertex and kd-tree keep the lowest index of each repeated point
+// --------------------
+void ScatteredInterpolant2D::newData(const double* P, const double* V, uint32_t n) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called newData()");
+#endif
+
+  // Clear existing data to prevent accumulation
+  this->Points.clear();
+  this->Vertices.clear();
+  this->gradients.clear();
+  this->duplicates.clear();
+  this->Points.reserve(n);
+  this->Vertices.reserve(n);
+
+  for(uint32_t i = 0; i < n; i++){
+    this->Points.emplace_back(P[2*i], P[2*i+1]);
+  }
+
+  // Group repeated points, stable sort keeps lowest index first
+  std::vector<std::size_t> order(n);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b){
+    return this->Points[a] < this->Points[b];
+  });
+  std::vector<std::size_t> unique;
+  unique.reserve(n);
+  for(std::size_t i = 0; i < n;){
+    std::size_t j = i + 1;
+    while(j < n && this->Points[order[j]] == this->Points[order[i]]){
+      j++;
+    }
+    if(j - i > 1){
+      this->duplicates.emplace_back(order.begin() + i, order.begin() + j);
+    }
+    unique.push_back(order[i]);
+    i = j;
+  }
+  std::sort(unique.begin(), unique.end());
+  for(std::size_t i : unique){
+    this->Vertices.emplace_back(this->Points[i], (unsigned)i);
+  }
+  this->values.assign(V, V + n);
+  this->mergeDuplicates();
+
+  // Delete existing triangulation and tree to prevent memory leaks
+  if(this->tree){
+    delete this->tree;
+    this->tree = nullptr;
+  }
+  if(this->delaunayTriangulation){
+    delete this->delaunayTriangulation;
+    this->delaunayTriangulation = nullptr;
+  }
+
+  this->delaunayTriangulation = new Dt(this->Vertices.begin(), this->Vertices.end());
+  this->tree = new Tree(unique.begin(), unique.end(),
+    Tree::Splitter(), Traits(search_map(this->Points)));
+  this->tree->build();
+}
+
+// setValues() function
+// --------------------
+void ScatteredInterpolant2D::setValues(const double* V) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called setValues()");
+#endif
+
+  std::copy(V, V + this->values.size(), this->values.begin());
+  this->mergeDuplicates();
+  this->gradients.clear();
+}
+
+// mergeDuplicates() function
+// Sets values of repeated points to their mean
+// --------------------
+void ScatteredInterpolant2D::mergeDuplicates(void) {
+  for(const std::vector<std::size_t>& group : this->duplicates){
+    double sum = 0;
+    for(std::size_t i : group){
+      sum += this->values[i];
+    }
+    double mean = sum / group.size();
+    for(std::size_t i : group){
+      this->values[i] = mean;
+    }
+  }
+}
+
+// estimateGradients() function
+// Gradients at data points from neighbors in triangulation, second ring
+// of neighbors is added for vertices with less than 5 neighbors
+// --------------------
+void ScatteredInterpolant2D::estimateGradients(void) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called estimateGradients()");
+#endif
+
+  if(!this->gradients.empty()){
+    return;
+  }
+  const Dt& dt = *this->delaunayTriangulation;
+  this->gradients.assign(this->values.size(), {0, 0});
+  if(dt.dimension() < 2){
+    return;
+  }
+  std::vector<Vertex_handle> handles;
+  handles.reserve(dt.number_of_vertices());
+  for(auto vit = dt.finite_vertices_begin(); vit != dt.finite_vertices_end(); ++vit){
+    handles.push_back(vit);
+  }
+
+  auto neighbors = [&](Vertex_handle v, std::vector<Vertex_handle>& out){
+    auto vc = dt.incident_vertices(v), done = vc;
+    do {
+      if(!dt.is_infinite(vc) &&
+          std::find(out.begin(), out.end(), Vertex_handle(vc)) == out.end()){
+        out.push_back(vc);
+      }
+    } while(++vc != done);
+  };
+
+  parallelFor(handles.size(), [&](std::size_t k){
+    Vertex_handle v = handles[k];
+    std::vector<Vertex_handle> ring;
+    neighbors(v, ring);
+    if(ring.size() < 5){
+      std::size_t first = ring.size();
+      for(std::size_t i = 0; i < first; i++){
+        neighbors(ring[i], ring);
+      }
+      ring.erase(std::remove(ring.begin(), ring.end(), v), ring.end());
+    }
+
+    unsigned id = v->info();
+    std::vector<double> dx(ring.size()), dy(ring.size()), dz(ring.size());
+    for(std::size_t i = 0; i < ring.size(); i++){
+      dx[i] = ring[i]->point().x() - v->point().x();
+      dy[i] = ring[i]->point().y() - v->point().y();
+      dz[i] = this->values[ring[i]->info()] - this->values[id];
+    }
+    double g[2];
+    fitGradient(dx.data(), dy.data(), dz.data(), ring.size(), g);
+    this->gradients[id] = {g[0], g[1]};
+  });
+
+  // Repeated points share gradient of merged vertex
+  std::vector<char> is_vertex(this->values.size(), 0);
+  for(const Vertex_handle& v : handles){
+    is_vertex[v->info()] = 1;
+  }
+  for(std::size_t i = 0; i < this->Points.size(); i++){
+    if(!is_vertex[i]){
+      this->gradients[i] = this->gradients[dt.nearest_vertex(this->Points[i])->info()];
+    }
+  }
+}
+
+// locate() function
+// Visibility walk from hint face, returns infinite face when point is
+// outside of convex hull
+// --------------------
+Face_handle ScatteredInterpolant2D::locate(const Point& p, Face_handle f) const {
+  const Dt& dt = *this->delaunayTriangulation;
+  if(f == Face_handle() || dt.is_infinite(f)){
+    f = dt.finite_faces_begin();
+  }
+  std::size_t max_steps = dt.number_of_faces() + 3;
+  for(std::size_t step = 0; step < max_steps; step++){
+    bool moved = false;
+    for(int i = 0; i < 3; i++){
+      const Point& a = f->vertex(dt.ccw(i))->point();
+      const Point& b = f->vertex(dt.cw(i))->point();
+      if(CGAL::orientation(a, b, p) == CGAL::RIGHT_TURN){
+        f = f->neighbor(i);
+        if(dt.is_infinite(f)){
+          return f;
+        }
+        moved = true;
+        break;
+      }
+    }
+    if(!moved){
+      return f;
+    }
+  }
+  return f;
+}
+
+// nearest() function
+// --------------------
+std::size_t ScatteredInterpolant2D::nearest(const Point& p) const {
+  K_neighbor_search::Distance tr_dist(search_map(this->Points));
+  K_neighbor_search search(*this->tree, p, 1, 0, true, tr_dist);
+  return search.begin()->first;
+}
+
+// natural() function
+// Sibson coordinates from areas stolen by inserted point (Watson's
+// formula over triangles in conflict with query point)
+// --------------------
+double ScatteredInterpolant2D::natural(const Point& p, Face_handle f) const {
+  const Dt& dt = *this->delaunayTriangulation;
+  std::vector<Face_handle> conflicts(1, f);
+  for(std::size_t k = 0; k < conflicts.size(); k++){
+    for(int i = 0; i < 3; i++){
+      Face_handle g = conflicts[k]->neighbor(i);
+      if(dt.is_infinite(g) ||
+          std::find(conflicts.begin(), conflicts.end(), g) != conflicts.end()){
+        continue;
+      }
+      if(CGAL::side_of_bounded_circle(g->vertex(0)->point(),
+          g->vertex(1)->point(), g->vertex(2)->point(), p) == CGAL::ON_BOUNDED_SIDE){
+        conflicts.push_back(g);
+      }
+    }
+  }
+
+  std::vector<std::pair<unsigned, double>> weights;
+  auto add = [&](unsigned id, double w){
+    for(auto& iw : weights){
+      if(iw.first == id){
+        iw.second += w;
+        return;
+      }
+    }
+    weights.emplace_back(id, w);
+  };
+  for(const Face_handle& g : conflicts){
+    const Point& a = g->vertex(0)->point();
+    const Point& b = g->vertex(1)->point();
+    const Point& c = g->vertex(2)->point();
+    Point o = CGAL::circumcenter(a, b, c);
+    Point ga = CGAL::circumcenter(p, b, c);
+    Point gb = CGAL::circumcenter(p, c, a);
+    Point gc = CGAL::circumcenter(p, a, b);
+    add(g->vertex(0)->info(), CGAL::area(o, gb, gc));
+    add(g->vertex(1)->info(), CGAL::area(o, gc, ga));
+    add(g->vertex(2)->info(), CGAL::area(o, ga, gb));
+  }
+
+  double sum = 0, result = 0;
+  for(const auto& iw : weights){
+    sum += iw.second;
+    result += iw.second * this->values[iw.first];
+  }
+  return result / sum;
+}
+
+// evaluate() function
+// Value at point p, hint is updated with the last located face
+// --------------------
+double ScatteredInterpolant2D::evaluate(const Point& p, int method,
+    bool extrap, Face_handle& hint) const {
+  const Dt& dt = *this->delaunayTriangulation;
+  if(method == METHOD_NEAREST){
+    return this->values[this->nearest(p)];
+  }
+
+  Face_handle f;
+  if(dt.dimension() == 2){
+    f = this->locate(p, hint);
+  }
+  if(f == Face_handle() || dt.is_infinite(f)){
+    if(!extrap){
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    // Linear extrapolation from nearest data point
+    std::size_t k = this->nearest(p);
+    return this->values[k] +
+      this->gradients[k][0] * (p.x() - this->Points[k].x()) +
+      this->gradients[k][1] * (p.y() - this->Points[k].y());
+  }
+  hint = f;
+
+  double x[3], y[3], z[3];
+  unsigned id[3];
+  for(int i = 0; i < 3; i++){
+    id[i] = f->vertex(i)->info();
+    x[i] = f->vertex(i)->point().x();
+    y[i] = f->vertex(i)->point().y();
+    z[i] = this->values[id[i]];
+  }
+  double d = (y[1] - y[2]) * (x[0] - x[2]) + (x[2] - x[1]) * (y[0] - y[2]);
+  double b[3];
+  b[0] = ((y[1] - y[2]) * (p.x() - x[2]) + (x[2] - x[1]) * (p.y() - y[2])) / d;
+  b[1] = ((y[2] - y[0]) * (p.x() - x[2]) + (x[0] - x[2]) * (p.y() - y[2])) / d;
+  b[2] = 1 - b[0] - b[1];
+  double linear = b[0] * z[0] + b[1] * z[1] + b[2] * z[2];
+
+  if(method == METHOD_CUBIC){
+    double gx[3], gy[3];
+    for(int i = 0; i < 3; i++){
+      gx[i] = this->gradients[id[i]][0];
+      gy[i] = this->gradients[id[i]][1];
+    }
+    return cloughTocher(x, y, z, gx, gy, b);
+  } else if(method == METHOD_NATURAL){
+    for(int i = 0; i < 3; i++){
+      if(p == f->vertex(i)->point()){
+        return z[i];
+      }
+    }
+    double value = this->natural(p, f);
+    return std::isfinite(value) ? value : linear;
+  }
+  return linear;
+}
+
+// interpolate() function
+// Scattered query points are processed in parallel blocks, each with
+// its own walk hint
+// --------------------
+void ScatteredInterpolant2D::interpolate(const double* x, const double* y,
+    std::size_t n, int method, bool extrap, double* out) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called interpolate()");
+#endif
+
+  if(extrap || method == METHOD_CUBIC){
+    this->estimateGradients();
+  }
+  const std::size_t block = 4096;
+  parallelFor((n + block - 1) / block, [&](std::size_t b){
+    Face_handle hint;
+    std::size_t end = (std::min)(n, (b + 1) * block);
+    for(std::size_t i = b * block; i < end; i++){
+      out[i] = this->evaluate(Point(x[2*i], y[2*i]), method, extrap, hint);
+    }
+  });
+}
+
+// interpolateGrid() function
+// Grid rows are filled in parallel, result is stored by rows (ny x nx)
+// --------------------
+void ScatteredInterpolant2D::interpolateGrid(const double* xq, uint32_t nx,
+    const double* yq, uint32_t ny, int method, bool extrap, double* out) {
+#ifdef DEBUG_SCATTERED_INTERPOLANT_2D
+  consoleLog(0, "Called interpolateGrid()");
+#endif
+
+  if(extrap || method == METHOD_CUBIC){
+    this->estimateGradients();
+  }
+  parallelFor(ny, [&](std::size_t j){
+    Face_handle hint;
+    for(uint32_t i = 0; i < nx; i++){
+      out[j*nx + i] = this->evaluate(Point(xq[i], yq[j]), method, extrap, hint);
+    }
+  });
+}
+
+Napi::Object InitAll(Napi::Env env, Napi::Object exports) {
+  return ScatteredInterpolant2D::Init(env, exports);
+}
+
+NODE_API_MODULE(NODE_GYP_MODULE_NAME, InitAll)
+
+}  // namespace scattered_interpolant_2d_ns
@@ -0,0 +1,127 @@
+// ScatteredInterpolant2D - scattered-interpolant-2d.h
+// Author: Milos Petrasinovic <mpetrasinovic@prdc.rs>
+// PR-DC, Republic of Serbia
+// info@prdc.rs
+// --------------------
+
+#ifndef SCATTERED_INTERPOLANT_2D_H
+#define SCATTERED_INTERPOLANT_2D_H
+
+//#define DEBUG_SCATTERED_INTERPOLANT_2D
+//#define DEBUG_SCATTERED_INTERPOLANT_2D_LEVEL 0
+
+#include <napi.h>
+#include <chrono>
+#include <thread>
+#include <Windows.h>
+#include <ctime>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <iostream>
+#include <vector>
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <exception>
+#include <functional>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <numeric>
+
+#include <Eigen/Dense>
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_vertex_base_with_info_2.h>
+
+#include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+
+#include "native-utils.h"
+
+namespace scattered_interpolant_2d_ns {
+
+using namespace std;
+using namespace std::chrono;
+using namespace native_utils_ns;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Gt;
+
+typedef CGAL::Triangulation_vertex_base_with_info_2<unsigned, Gt> Vb;
+typedef CGAL::Triangulation_data_structure_2<Vb> Tds;
+typedef CGAL::Delaunay_triangulation_2<Gt, Tds> Dt;
+typedef Dt::Point Point;
+typedef Dt::Face_handle Face_handle;
+typedef Dt::Vertex_handle Vertex_handle;
+
+class search_map {
+    const std::vector<Point>& points;
+  public:
+    typedef Point value_type;
+    typedef const value_type& reference;
+    typedef std::size_t key_type;
+    typedef boost::lvalue_property_map_tag category;
+    search_map(const std::vector<Point>& pts):points(pts){}
+    reference operator[](key_type k) const {return points[k];}
+    friend reference get(const search_map& ppmap, key_type i)
+    {return ppmap[i];}
+};
+
+typedef CGAL::Search_traits_2<Gt> Trb;
+typedef CGAL::Search_traits_adapter<std::size_t, search_map, Trb> Traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits> K_neighbor_search;
+typedef K_neighbor_search::Tree Tree;
+
+// Interpolation methods
+enum Method {METHOD_LINEAR, METHOD_NEAREST, METHOD_NATURAL, METHOD_CUBIC};
+
+// Numerical kernels
+bool fitGradient(const double* dx, const double* dy, const double* dz,
+  std::size_t k, double* g);
+double cloughTocher(const double* x, const double* y, const double* f,
+  const double* gx, const double* gy, const double* b);
+
+class ScatteredInterpolant2D : public Napi::ObjectWrap<ScatteredInterpolant2D> {
+ public:
+  static Napi::Object Init(Napi::Env env, Napi::Object exports);
+  ScatteredInterpolant2D(const Napi::CallbackInfo& info);
+  ~ScatteredInterpolant2D();
+
+  std::vector<Point> Points;
+  std::vector<std::pair<Point, unsigned>> Vertices;
+  std::vector<double> values;
+  void newData(const double*, const double*, uint32_t);
+  void setValues(const double*);
+  void mergeDuplicates(void);
+  void estimateGradients(void);
+  double evaluate(const Point&, int, bool, Face_handle&) const;
+  void interpolate(const double*, const double*, std::size_t, int, bool, double*);
+  void interpolateGrid(const double*, uint32_t, const double*, uint32_t, int, bool, double*);
+
+  // JavaScript wrapper methods
+  void NewDataJS(const Napi::CallbackInfo& info);
+  void SetValuesJS(const Napi::CallbackInfo& info);
+  Napi::Value InterpolateJS(const Napi::CallbackInfo& info);
+  Napi::Value InterpolateGridJS(const Napi::CallbackInfo& info);
+
+private:
+  bool hasData(Napi::Env env);
+  bool readOptions(const Napi::CallbackInfo& info, std::size_t first,
+    int& method, bool& extrap);
+  Face_handle locate(const Point&, Face_handle) const;
+  std::size_t nearest(const Point&) const;
+  double natural(const Point&, Face_handle) const;
+
+  Dt *delaunayTriangulation;
+  Tree *tree;
+  std::vector<std::array<double, 2>> gradients;
+  std::vector<std::vector<std::size_t>> duplicates;
+};
+
+}// namespace scattered_interpolant_2d_ns
+
+#endif // SCATTERED_INTERPOLANT_2D_H
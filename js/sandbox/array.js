@@ -667,42 +667,194 @@ class PRDC_JSLAB_LIB_ARRAY {
   
   /**
    * Applies a moving average filter to an input array while keeping the output array the same size.
-   * @param {number[]} inputArray - The array of numbers to filter.
-   * @param {number} windowSize - The size of the moving window (number of elements to average).
-   * @returns {number[]} The filtered array with the same length as the input array.
+   * @param {number[]|Float64Array} inputArray - The array of numbers to filter.
+   * @param {number} windowSize - The size of the moving window, floor(windowSize/2) elements on each side are averaged.
+   * @returns {number[]|Float64Array} The filtered array with the same length as the input array.
    */
   averageMoving(inputArray, windowSize) {
-    var result = [];
-    var len = inputArray.length;
-    var halfWindow = Math.floor(windowSize / 2);
-
-    for(var i = 0; i < len; i++) {
-      var start = i - halfWindow;
-      var end = i + halfWindow;
-
-      // Adjust the window if it goes beyond the array bounds
-      if(start < 0) start = 0;
-      if(end >= len) end = len - 1;
-
-      var sum = 0;
-      var count = 0;
-      for(var j = start; j <= end; j++) {
-        sum += inputArray[j];
-        count++;
-      }
-      result.push(sum / count);
-    }
-    return result;
+    var half = Math.floor(windowSize / 2);
+    return this._movstat('mean', inputArray, [half, half]);
   }
   
   /**
-   * Applies a moving average filter to an input array while keeping the output array the same size.
-   * @param {number[]} inputArray - The array of numbers to filter.
-   * @param {number} windowSize - The size of the moving window (number of elements to average).
-   * @returns {number[]} The filtered array with the same length as the input array.
+   * Computes moving statistic natively in O(n) per channel, channels are processed in parallel.
+   * @param {string} stat - Statistic: 'sum', 'mean', 'var', 'std', 'min', 'max' or 'median'.
+   * @param {number[]|Float64Array} A - Input data, for multiple channels column-major with channels columns.
+   * @param {number|number[]} k - Window length centered on each element or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options.
+   * @param {string|number} [opts.endpoints='shrink'] - Endpoints handling: 'shrink', 'discard', 'fill' (NaN) or fill value.
+   * @param {number} [opts.channels=1] - Number of channels.
+   * @returns {number[]|Float64Array} Moving statistic, Float64Array for typed input.
+   */
+  _movstat(stat, A, k, opts = {}) {
+    var kb, kf;
+    if(Array.isArray(k)) {
+      kb = k[0];
+      kf = k[1];
+    } else if(k % 2 === 1) {
+      kb = kf = (k - 1) / 2;
+    } else {
+      kb = k / 2;
+      kf = k / 2 - 1;
+    }
+    var endpoints = opts.endpoints === undefined ? 'shrink' : opts.endpoints;
+    var channels = opts.channels || 1;
+    var y = this.jsl.inter.env.native_module.movstat(A, channels, stat, 
+      kb, kf, endpoints);
+    return ArrayBuffer.isView(A) ? y : Array.from(y);
+  }
+
+  /**
+   * Applies a moving average filter with window of k elements, as in MATLAB movmean.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving mean.
    */
-  movmean(inputArray, windowSize) {
-    return this.averageMoving(inputArray, windowSize);
+  movmean(A, k, opts) {
+    return this._movstat('mean', A, k, opts);
+  }
+
+  /**
+   * Computes moving sum with window of k elements.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving sum.
+   */
+  movsum(A, k, opts) {
+    return this._movstat('sum', A, k, opts);
+  }
+
+  /**
+   * Computes moving variance with window of k elements, normalized by number of elements minus one.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving variance.
+   */
+  movvar(A, k, opts) {
+    return this._movstat('var', A, k, opts);
+  }
+
+  /**
+   * Computes moving standard deviation with window of k elements, normalized by number of elements minus one.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving standard deviation.
+   */
+  movstd(A, k, opts) {
+    return this._movstat('std', A, k, opts);
+  }
+
+  /**
+   * Computes moving minimum with window of k elements.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving minimum.
+   */
+  movmin(A, k, opts) {
+    return this._movstat('min', A, k, opts);
+  }
+
+  /**
+   * Computes moving maximum with window of k elements.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving maximum.
+   */
+  movmax(A, k, opts) {
+    return this._movstat('max', A, k, opts);
+  }
+
+  /**
+   * Computes moving median with window of k elements.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} k - Window length or [kb, kf] elements before and after.
+   * @param {Object} [opts] - Options with endpoints ('shrink', 'discard', 'fill' or fill value) and channels.
+   * @returns {number[]|Float64Array} Moving median.
+   */
+  movmedian(A, k, opts) {
+    return this._movstat('median', A, k, opts);
+  }
+
+  /**
+   * Computes descriptive statistics in a single pass, NaN values are ignored and counted.
+   * @param {number[]|Float64Array} A - Input data, channels stored one after another.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {Object} Object with count, mean, var, std, skewness, kurtosis, min, max and nanCount, arrays with one value per channel for several channels.
+   */
+  describe(A, channels = 1) {
+    var result = this.jsl.inter.env.native_module.describe(A, channels);
+    Object.keys(result).forEach((key) => {
+      result[key] = channels === 1 ? result[key][0] : Array.from(result[key]);
+    });
+    return result;
+  }
+
+  /**
+   * Counts data in histogram bins with MATLAB histcounts conventions, last bin includes its right edge.
+   * Unlike MATLAB, bin count gives equal width edges linear between minimum and maximum of finite data (or BinLimits) without rounding to nice values.
+   * @param {number[]|Float64Array} A - Input data.
+   * @param {number|number[]} [bins=10] - Number of bins, or bin edges.
+   * @param {Object} [opts] - Options with BinLimits [lo, hi] and Normalization ('count', 'probability', 'pdf', 'cdf', 'countdensity' or 'cumcount').
+   * @returns {Array} Bin values and bin edges.
+   */
+  histcounts(A, bins = 10, opts = {}) {
+    var native_module = this.jsl.inter.env.native_module;
+    var edges;
+    if(typeof bins === 'number') {
+      var limits = opts.BinLimits;
+      if(!limits) {
+        // Limits of finite data, NaN and Inf values are not binned
+        var lo = Infinity, hi = -Infinity;
+        for(var i = 0; i < A.length; i++) {
+          if(Number.isFinite(A[i])) {
+            if(A[i] < lo) lo = A[i];
+            if(A[i] > hi) hi = A[i];
+          }
+        }
+        limits = lo <= hi ? [lo, hi] : [0, 1];
+        if(limits[0] === limits[1]) {
+          limits = [limits[0] - 0.5, limits[1] + 0.5];
+        }
+      }
+      edges = this.linspace(limits[0], limits[1], bins + 1);
+      edges[bins] = limits[1];
+    } else {
+      edges = Array.from(bins);
+    }
+
+    var counts = Array.from(native_module.histcounts(A, edges));
+    var widths = counts.map((_, i) => edges[i + 1] - edges[i]);
+    var total = A.length;
+    switch(opts.Normalization || 'count') {
+      case 'count':
+        break;
+      case 'probability':
+        counts = counts.map((c) => c / total);
+        break;
+      case 'pdf':
+        counts = counts.map((c, i) => c / (total * widths[i]));
+        break;
+      case 'countdensity':
+        counts = counts.map((c, i) => c / widths[i]);
+        break;
+      case 'cumcount':
+      case 'cdf':
+        var sum = 0;
+        counts = counts.map((c) => (sum += c));
+        if(opts.Normalization === 'cdf') {
+          counts = counts.map((c) => c / total);
+        }
+        break;
+      default:
+        this.jsl.inter.env.error('@histcounts: '+this.jsl.inter.lang.string(235));
+    }
+    return [counts, edges];
   }
   
   /**
@@ -1390,6 +1542,11 @@ class PRDC_JSLAB_LIB_ARRAY {
       this.jsl.inter.env.error('@sorti: '+this.jsl.inter.lang.string(190));
     }
 
+    if(A.every((a) => typeof a === 'number')) {
+      var result = this.jsl.inter.env.native_module.sort(A, 1, false);
+      return [Array.from(result.y), Array.from(result.index)];
+    }
+
     // Create an array of indices and sort based on values in A,
     // with NaNs sorted to the end.
     const indices = A.map((_, idx) => idx);
@@ -1405,6 +1562,51 @@ class PRDC_JSLAB_LIB_ARRAY {
     return [sorted_scores, indices];
   }
 
+  /**
+   * Returns stable sort permutation of numeric data, NaN values are placed last in ascending and first in descending order.
+   * @param {number[]|Float64Array} A - Data to sort, or keys stored column by column when sorting by several keys.
+   * @param {(string|string[])} [direction='ascend'] - Sort direction ('ascend' or 'descend') or one direction per key.
+   * @param {number} [keys=1] - Number of keys, first key has highest priority.
+   * @returns {number[]|Uint32Array} Indices of sorted elements.
+   */
+  argsort(A, direction = 'ascend', keys = 1) {
+    var descending = Array.isArray(direction) ?
+      direction.map((d) => this._sortDescending(d)) :
+      this._sortDescending(direction);
+    var index = this.jsl.inter.env.native_module.argsort(A, keys, descending);
+    return ArrayBuffer.isView(A) ? index : Array.from(index);
+  }
+
+  /**
+   * Checks sort direction.
+   * @param {string} direction - Sort direction ('ascend', 'descend', 'asc' or 'desc').
+   * @returns {boolean} True for descending order.
+   */
+  _sortDescending(direction) {
+    if(['descend', 'desc'].includes(direction)) {
+      return true;
+    } else if(['ascend', 'asc'].includes(direction)) {
+      return false;
+    }
+    this.jsl.inter.env.error('@argsort: '+this.jsl.inter.lang.string(235));
+  }
+
+  /**
+   * Computes percentiles of data ignoring NaN values, as in MATLAB prctile.
+   * @param {number[]|Float64Array} A - Input data, channels stored one after another.
+   * @param {number|number[]} p - Percentiles in range [0, 100].
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number|number[]|Float64Array} Percentiles, for several channels grouped by channel.
+   */
+  prctile(A, p, channels = 1) {
+    var y = this.jsl.inter.env.native_module.prctile(A, channels,
+      Array.isArray(p) || ArrayBuffer.isView(p) ? p : [p]);
+    if(typeof p === 'number' && channels === 1) {
+      return y[0];
+    }
+    return ArrayBuffer.isView(A) ? y : Array.from(y);
+  }
+
   /**
    * Computes the weighted sum of two vectors and stores the result in the `ret` array.
    * @param {number[]} ret - The array to store the result.
@@ -1434,10 +1636,19 @@ class PRDC_JSLAB_LIB_ARRAY {
    * @param {number} u - The upper bound of the range.
    * @param {number} rows - The number of rows.
    * @param {number} cols - The number of columns.
-   * @param {Function} [randFun=Math.random] - The random function to use.
+   * @param {(Function|Object)} [randFun=Math.random] - The random function to use or native generator created with rng.
    * @returns {Array<number>} An array filled with random numbers within the specified range.
    */
   arrayRand(l, u, rows, cols, randFun) {
+    if(this._isRandomGenerator(randFun)) {
+      var r = randFun.rand(rows * cols, 0, 1);
+      var A = new Array(rows * cols);
+      for(var i = 0; i < A.length; i++) {
+        var j = i % rows;
+        A[i] = l[j] + (u[j] - l[j]) * r[i];
+      }
+      return A;
+    }
     if(!this.jsl.inter.format.isFunction(randFun)) {
       randFun = Math.random;
     }
@@ -1449,16 +1660,29 @@ class PRDC_JSLAB_LIB_ARRAY {
    * @param {number[]} lu - An array containing the lower and upper bounds [lower, upper].
    * @param {number} rows - The number of rows.
    * @param {number} cols - The number of columns.
-   * @param {Function} [randFun=Math.random] - The random function to use.
+   * @param {(Function|Object)} [randFun=Math.random] - The random function to use or native generator created with rng.
    * @returns {Array<number>} An array filled with random integers within the specified range.
    */
   arrayRandi(lu, rows, cols, randFun) {
+    if(this._isRandomGenerator(randFun)) {
+      return Array.from(randFun.randi(rows * cols, lu[0], lu[1]));
+    }
     if(!this.jsl.inter.format.isFunction(randFun)) {
       randFun = Math.random;
     }
     return Array.from({ length: rows * cols }, () => Math.floor(randFun() * (lu[1] - lu[0] + 1) + lu[0]));
   }
   
+  /**
+   * Checks if object is native random generator.
+   * @param {*} randFun - Random function or generator.
+   * @returns {boolean} True for native generator.
+   */
+  _isRandomGenerator(randFun) {
+    return typeof randFun === 'object' && randFun !== null && 
+      typeof randFun.randi === 'function';
+  }
+
   /**
    * Normalizes a 3D vector.
    * @param {number[]} v - The vector to normalize.
@@ -90,11 +90,17 @@ class PRDC_JSLAB_LIB_CONTROL {
    * @param {number[]} numc - Continuous-time numerator coefficients.
    * @param {number[]} denc - Continuous-time denominator coefficients.
    * @param {number} Ts - Sampling time.
+   * @param {string} [method='zoh'] - Discretization method: 'zoh', 'foh' or 'tustin'.
    * @returns {object} Discrete-time transfer function representation { num, den }.
    */
-  c2d(numc, denc, Ts) {
+  c2d(numc, denc, Ts, method = 'zoh') {
     const sysc = this.tf2ss(numc, denc);
-    const sysd = this._c2dZOH(sysc, Ts);
+    let sysd;
+    if(method === 'zoh') {
+      sysd = this._c2dZOH(sysc, Ts);
+    } else {
+      sysd = this._c2dNative(sysc, Ts, method);
+    }
     return this.ss2tf(sysd);
   }
 
@@ -105,76 +111,114 @@ class PRDC_JSLAB_LIB_CONTROL {
    * @returns {object} Discrete-time state-space system { A, B, C, D, Ts }.
    */
   _c2dZOH(sysc, Ts) {
-    const inter = this.jsl.inter;
-    const { A, B, C, D } = sysc;
-    const n = A.length;
-
-    const M = A.map((row, i) => [...row, B[i]]);
-    M.push(inter.zeros(n + 1));
-    const M_exp = this.jsl.inter.env.math.expm(this.jsl.inter.env.math.multiply(M, Ts))._data.slice(0, n);
+    return this._c2dNative(sysc, Ts, 'zoh');
+  }
 
-    const Ad = M_exp.map(row => row.slice(0, n));
-    const Bd = M_exp.map(row => row.slice(n));
+  /**
+   * Convert a continuous-time single-input single-output state-space system 
+   * to discrete-time using native matrix exponential.
+   * @param {object} sysc - Continuous-time state-space system { A, B, C, D }.
+   * @param {number} Ts - Sampling time.
+   * @param {string} method - Discretization method: 'zoh', 'foh' or 'tustin'.
+   * @returns {object} Discrete-time state-space system { A, B, C, D, Ts }.
+   */
+  _c2dNative(sysc, Ts, method) {
+    const { A, B, C, D, n } = this._ssToNative(sysc);
+    const res = this.jsl.inter.env.native_module.c2d(A, B, C, D, n, 1, 1, 
+      Ts, method);
 
-    return this.ss(Ad, Bd, C, D, Ts);
+    const Ad = [];
+    for(let i = 0; i < n; i++) {
+      Ad.push(Array.from({ length: n }, (_, j) => res.A[j * n + i]));
+    }
+    const Bd = Array.from(res.B, b => [b]);
+    return this.ss(Ad, Bd, Array.from(res.C), res.D[0], Ts);
   }
   
   /**
-   * Simulate the time response of a discrete-time linear system.
-   * @param {number[]} sys - transfer function of system.
+   * Flattens single-input single-output state-space matrices to column-major 
+   * Float64Arrays for native functions.
+   * @param {object} sys - State-space system { A, B, C, D }.
+   * @returns {object} Flat matrices { A, B, C, D, n }.
+   */
+  _ssToNative(sys) {
+    const n = sys.A.length;
+    const A = new Float64Array(n * n);
+    for(let i = 0; i < n; i++) {
+      for(let j = 0; j < n; j++) {
+        A[j * n + i] = sys.A[i][j];
+      }
+    }
+    const B = Float64Array.from(sys.B.map(b => Array.isArray(b) ? b[0] : b));
+    const C = Float64Array.from(sys.C);
+    const D = Float64Array.of(sys.D);
+    return { A, B, C, D, n };
+  }
+  
+  /**
+   * Simulate the time response of a linear system using native direct form 
+   * II transposed or state-space recursion.
+   * @param {object} sys - Transfer function { num, den } or state-space system { A, B, C, D }.
    * @param {number[]} u - Input signal array.
    * @param {number[]} t - Time vector array.
+   * @param {number} [Ts] - Sampling time used to discretize continuous system.
    * @returns {object} An object containing the response:
    *                   - y: Output signal array.
    *                   - t: Time vector array (same as input).
    */
   lsim(sys, u, t, Ts) {
-    const inter = this.jsl.inter;
+    const native_module = this.jsl.inter.env.native_module;
     var sysd = sys;
-    if(!sys.Ts && Ts) {
-      sysd = this.c2d(sys.num, sys.den, Ts);
-    }
-    var num = sysd.num;
-    var den = sysd.den;
-
-    // Normalize the denominator coefficients so that den[0] = 1
-    if(den[0] !== 1) {
-      const den0 = den[0];
-      for(let i = 0; i < den.length; i++) {
-        den[i] /= den0;
+    var y;
+    if(sys.A) {
+      if(!sys.Ts && Ts) {
+        sysd = this._c2dNative(sys, Ts, 'zoh');
       }
-      for(let i = 0; i < num.length; i++) {
-        num[i] /= den0;
+      const { A, B, C, D, n } = this._ssToNative(sysd);
+      y = native_module.lsimSS(A, B, C, D, n, 1, 1, Float64Array.from(u));
+    } else {
+      if(!sys.Ts && Ts) {
+        sysd = this.c2d(sys.num, sys.den, Ts);
       }
+      y = native_module.lsim(Float64Array.from(sysd.num), 
+        Float64Array.from(sysd.den), Float64Array.from(u));
     }
+    return { y: Array.from(y), t };
+  }
+  
+  /**
+   * Simulate the time response of many transfer functions to the same input 
+   * in one native call.
+   * @param {object[]} systems - Array of transfer functions { num, den }.
+   * @param {number[]} u - Input signal array.
+   * @param {number[]} t - Time vector array.
+   * @param {number} [Ts] - Sampling time used to discretize continuous systems.
+   * @returns {object} An object containing the responses:
+   *                   - y: Array of output signal arrays, one for each system.
+   *                   - t: Time vector array (same as input).
+   */
+  lsimBatch(systems, u, t, Ts) {
+    const count = systems.length;
+    const sysd = systems.map((sys) => (!sys.Ts && Ts) ? 
+      this.c2d(sys.num, sys.den, Ts) : sys);
+    const L = Math.max(...sysd.map((sys) => 
+      Math.max(sys.num.length, sys.den.length)));
 
-    const N = u.length;
-    var y = inter.zeros(N); // Initialize output array with zeros
-
-    // Iterate over each time step starting from n=1
-    for(let n = 0; n < N; n++) {
-      // Compute feedforward terms: sum(num[k] * u[n - k}) for k =0 to M
-      for(let k = 0; k < num.length; k++) {
-        const idx = n - k;
-        if(idx >= 0) {
-          y[n] += num[k] * u[idx];
-        }
-      }
+    const nums = new Float64Array(count * L);
+    const dens = new Float64Array(count * L);
+    sysd.forEach((sys, k) => {
+      const shift = Math.max(0, sys.den.length - sys.num.length);
+      nums.set(sys.num, k * L + shift);
+      dens.set(sys.den, k * L);
+    });
 
-      // Compute feedback terms: sum(den[k} * y[n - k}) for k =1 to N
-      for(let k = 1; k < den.length; k++) {
-        const idx = n - k;
-        if(idx >= 0) {
-          y[n] -= den[k] * y[idx];
-        }
-      }
-    }
-    
-    if(num.length < den.length) {
-      var n = den.length - num.length;
-      y = [...inter.zeros(n), ...y.slice(0, y.length - n)];
+    const N = u.length;
+    const Y = this.jsl.inter.env.native_module.lsimBatch(nums, dens, 
+      Float64Array.from(u), count);
+    const y = [];
+    for(let k = 0; k < count; k++) {
+      y.push(Array.from(Y.subarray(k * N, (k + 1) * N)));
     }
-    
     return { y, t };
   }
   
@@ -193,19 +237,29 @@ class PRDC_JSLAB_LIB_CONTROL {
   }
   
   /**
-   * Estimates a transfer function model using numerical optimization.
+   * Estimates a continuous-time transfer function model. Initial model is 
+   * obtained with ARX least squares and refined natively with 
+   * Levenberg-Marquardt or Nelder-Mead.
    * @param {Array<number>} t - Time vector.
    * @param {Array<number>} u - Input signal vector.
    * @param {Array<number>} y - Output signal vector.
    * @param {number} np - Number of poles.
    * @param {number} nz - Number of zeros.
-   * @param {string} [method='NelderMead'] - Optimization method ('NelderMead' or 'Powell').
-   * @returns {{sys: object, error: number}} Estimated transfer function and mean squared error.
+   * @param {string} [method='NelderMead'] - Optimization method ('LM', 'NelderMead' or 'Powell').
+   * @param {Object} [options] - Native optimizer options { maxIterations, tol }.
+   * @returns {{sys: object, error: number, fit: number, iterations: number}} Estimated transfer function, mean squared error, fit percentage (NaN for constant output that is not matched exactly) and number of iterations.
    */
-  tfest(t, u, y, np, nz, method = 'NelderMead') {
+  tfest(t, u, y, np, nz, method = 'NelderMead', options = {}) {
     const inter = this.jsl.inter;
-    var obj = this;
     var Ts = inter.mean(inter.diff(t));
+    if(method == 'LM' || method == 'NelderMead') {
+      var r = this.jsl.inter.env.native_module.tfest(Float64Array.from(u), 
+        Float64Array.from(y), Ts, np, nz, method.toLowerCase(), options);
+      return {sys: inter.tf(Array.from(r.num), Array.from(r.den)), 
+        error: r.mse, fit: r.fit, iterations: r.iterations};
+    }
+    
+    var obj = this;
     var N = np+nz+1;
     var f = (x) => { // funkcija prilagodjenosti
       try {
@@ -219,12 +273,7 @@ class PRDC_JSLAB_LIB_CONTROL {
         return Infinity;
       }
     };
-    var r;
-    if(method == 'NelderMead') {
-      r = this.jsl.inter.optim.optimNelderMead(f, inter.zeros(N));
-    } else if(method == 'Powell') {
-      r = this.jsl.inter.optim.optimPowell(f, inter.zeros(N));
-    }
+    var r = this.jsl.inter.optim.optimPowell(f, inter.zeros(N));
     var den = [1, ...r.x.slice(0, np)];
     var num = r.x.slice(np);
     return {sys: inter.tf(num, den), error: r.fx};
@@ -426,6 +426,12 @@ class PRDC_JSLAB_LIB_FORMAT {
    * @returns {Array<number>} Sorted indices.
    */
   buildSortedIndices(length, getter, direction = 'asc') {
+    var keys = this.numericSortKeys(length, [getter]);
+    if(keys) {
+      var sorted = Array.from(this.jsl.inter.env.native_module.argsort(keys, 1, false));
+      return direction === 'desc' ? sorted.reverse() : sorted;
+    }
+
     var factor = direction === 'desc' ? -1 : 1;
     var indices = Array.from({ length: length }, function(_, i) {
       return i;
@@ -441,6 +447,59 @@ class PRDC_JSLAB_LIB_FORMAT {
     return indices;
   }
 
+  /**
+   * Builds stable sorted index order by several keys, first key has highest priority.
+   * @param {number} length - Number of rows/items.
+   * @param {Array<Function>} getters - Getters by index, one per key.
+   * @param {(string|Array<string>)} [directions='asc'] - Sort direction or one direction per key.
+   * @returns {Array<number>} Sorted indices.
+   */
+  buildSortedIndicesMulti(length, getters, directions = 'asc') {
+    var factors = getters.map(function(_, k) {
+      var direction = Array.isArray(directions) ? directions[k] : directions;
+      return direction === 'desc' ? -1 : 1;
+    });
+    var keys = this.numericSortKeys(length, getters);
+    if(keys) {
+      return Array.from(this.jsl.inter.env.native_module.argsort(keys, 
+        getters.length, factors.map(function(f) { return f < 0; })));
+    }
+
+    var indices = this.rangeIndices(length);
+    indices.sort((i, j) => {
+      for(var k = 0; k < getters.length; k++) {
+        var cmp = this.compareMixedValues(getters[k](i), getters[k](j));
+        if(cmp !== 0) {
+          return cmp * factors[k];
+        }
+      }
+      return i - j;
+    });
+    return indices;
+  }
+
+  /**
+   * Collects numeric sort keys column by column for native sorting.
+   * @param {number} length - Number of rows/items.
+   * @param {Array<Function>} getters - Getters by index, one per key.
+   * @returns {(Float64Array|null)} Keys, or null if any value is not a number or date.
+   */
+  numericSortKeys(length, getters) {
+    var keys = new Float64Array(length * getters.length);
+    for(var k = 0; k < getters.length; k++) {
+      for(var i = 0; i < length; i++) {
+        var value = getters[k](i);
+        if(value instanceof Date) {
+          value = value.getTime();
+        } else if(typeof value !== 'number') {
+          return null;
+        }
+        keys[k * length + i] = value;
+      }
+    }
+    return keys;
+  }
+
   /**
    * Creates [0, ..., n - 1].
    * @param {number} n - Length.
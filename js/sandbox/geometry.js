@@ -1046,6 +1046,107 @@ class PRDC_JSLAB_LIB_GEOMETRY {
    * @returns {Array} - An array containing boundary facets and the volume.
    */
   boundary3D(points, shrink = 0.5) {
+    var shp = this._alphaShape3D(points, shrink);
+    var V = shp.getVolume();
+    var bf = shp.getBoundaryFacets();
+    shp = null;
+    return [bf, V];
+  }
+
+  /**
+   * Generates render-ready buffers of the boundary of a 3D shape based on points and a shrink factor.
+   * @param {number[][]} points - Array of points defining the shape.
+   * @param {number} [shrink=0.5] - Factor by which to shrink the boundary.
+   * @returns {{ positions: Float32Array, normals: Float32Array, indices: Uint32Array, pointIndices: Uint32Array }} - Boundary vertex positions and normals, triangle indices and input point index of each vertex.
+   */
+  renderBuffers3D(points, shrink = 0.5) {
+    var shp = this._alphaShape3D(points, shrink);
+    var buffers = shp.getRenderBuffers();
+    shp = null;
+    return buffers;
+  }
+
+  /**
+   * Cuts the boundary of a 3D shape based on points and a shrink factor with planes.
+   * @param {number[][]} points - Array of points defining the shape.
+   * @param {number[][]} planes - Array of planes [a, b, c, d] with a*x + b*y + c*z + d = 0.
+   * @param {number} [shrink=0.5] - Factor by which to shrink the boundary.
+   * @returns {Object[]} - For each plane { polylines, areas, area } with polylines as arrays of [x, y, z] points, area of each closed polyline and net sectional area.
+   */
+  slice3D(points, planes, shrink = 0.5) {
+    var shp = this._alphaShape3D(points, shrink);
+    var sections = shp.slice(planes);
+    shp = null;
+    return sections.map(function(section) {
+      return {
+        polylines: section.polylines.map(function(pl) {
+          var P = [];
+          for(var i = 0; i + 2 < pl.length; i += 3) {
+            P.push([pl[i], pl[i+1], pl[i+2]]);
+          }
+          return P;
+        }),
+        areas: Array.from(section.areas),
+        area: section.area
+      };
+    });
+  }
+
+  /**
+   * Checks which query points are inside of the 3D shape based on points and a shrink factor.
+   * The shape and its occupancy grid are kept and reused by following calls with same points, shrink and resolution.
+   * @param {number[][]|Float64Array} points - Array of [x, y, z] points defining the shape or flat Float64Array [x0, y0, z0, ...].
+   * @param {number[][]|Float64Array} query - Array of [x, y, z] query points or flat Float64Array [x0, y0, z0, ...].
+   * @param {number} [shrink=0.5] - Factor by which to shrink the boundary.
+   * @param {number} [resolution=64] - Number of occupancy grid cells along the longest side (at most 256), 0 for exact classification of every point.
+   * @returns {boolean[]} - True for query points inside of the shape, points with NaN coordinates are outside.
+   */
+  inShape3D(points, query, shrink = 0.5, resolution = 64) {
+    var P = this._flatPoints3D(points);
+    var cache = this._in_shape_3d;
+    if(!cache || cache.shrink !== shrink || cache.resolution !== resolution ||
+        cache.points.length !== P.length || 
+        cache.points.some(function(v, i) { return !Object.is(v, P[i]); })) {
+      var pts = [];
+      for(var i = 0; i + 2 < P.length; i += 3) {
+        pts.push([P[i], P[i+1], P[i+2]]);
+      }
+      var shp = this._alphaShape3D(pts, shrink);
+      if(resolution > 0) {
+        shp.buildOccupancyGrid(resolution);
+      }
+      cache = { points: Float64Array.from(P), shrink, resolution, shp };
+      this._in_shape_3d = cache;
+    }
+    var tf = cache.shp.checkInShape(this._flatPoints3D(query));
+    return Array.from(tf, function(v) { return v === 1; });
+  }
+
+  /**
+   * Converts points to flat Float64Array.
+   * @param {number[][]|Float64Array} points - Array of [x, y, z] points or flat Float64Array [x0, y0, z0, ...].
+   * @returns {Float64Array} - Flat array [x0, y0, z0, x1, ...].
+   */
+  _flatPoints3D(points) {
+    if(points instanceof Float64Array) {
+      return points;
+    }
+    var P = new Float64Array(points.length * 3);
+    for(var i = 0; i < points.length; i++) {
+      P[3*i] = points[i][0];
+      P[3*i+1] = points[i][1];
+      P[3*i+2] = points[i][2];
+    }
+    return P;
+  }
+
+  /**
+   * Creates a native 3D alpha shape with alpha value selected from the spectrum by a shrink factor.
+   * @param {number[][]} points - Array of points defining the shape.
+   * @param {number} [shrink=0.5] - Factor by which to shrink the boundary.
+   * @returns {Object} - AlphaShape3D object with alpha value set.
+   */
+  _alphaShape3D(points, shrink = 0.5) {
     var shp = new this.jsl.inter.env.AlphaShape3D(); 
     shp.newShape(points);
     
@@ -1059,12 +1160,69 @@ class PRDC_JSLAB_LIB_GEOMETRY {
     var alphaval = subspec[idx];
 
     shp.setAlpha(alphaval);
-    var V = shp.getVolume();
-    var bf = shp.getBoundaryFacets();
+    return shp;
+  }
+
+  /**
+   * Generates the boundary of a planar shape based on points and a shrink factor.
+   * @param {number[][]|Float64Array} points - Array of [x, y] points or flat Float64Array [x0, y0, x1, y1, ...].
+   * @param {number} [shrink=0.5] - Factor by which to shrink the boundary.
+   * @returns {Array} - An array containing boundary polylines (arrays of point indices) and the area.
+   */
+  boundary2D(points, shrink = 0.5) {
+    var P = points;
+    if(!(points instanceof Float64Array)) {
+      P = new Float64Array(points.length * 2);
+      for(var i = 0; i < points.length; i++) {
+        P[2*i] = points[i][0];
+        P[2*i+1] = points[i][1];
+      }
+    }
+
+    var shp = new this.jsl.inter.env.AlphaShape2D();
+    shp.newShape(P);
+
+    var Acrit = shp.getCriticalAlpha('one-region');
+    var spec = Array.from(shp.getAlphaSpectrum());
+
+    var idx = spec.indexOf(Acrit);
+    var subspec = spec.slice(idx);
+
+    var idx = Math.max(Math.ceil((1 - shrink) * subspec.length) - 1, 0);
+    var alphaval = subspec[idx];
+
+    shp.setAlpha(alphaval);
+    var A = shp.getArea();
+    var bl = shp.getBoundaryPolylines();
+    var polylines = [];
+    for(var k = 0; k + 1 < bl.offsets.length; k++) {
+      polylines.push(Array.from(bl.indices.subarray(bl.offsets[k], bl.offsets[k+1])));
+    }
     shp = null;
-    return [bf, V];
+    return [polylines, A];
   }
-        
+
+  /**
+   * Estimates unit normals of a point cloud from its k nearest neighbors.
+   * @param {number[][]|Float64Array} points - Array of [x, y, z] points or flat Float64Array [x0, y0, z0, ...].
+   * @param {number} [k=18] - Number of neighbors used for each point.
+   * @param {boolean} [orient=true] - Orient normals consistently using a minimum spanning tree.
+   * @returns {Float64Array} - Flat array of normals [nx0, ny0, nz0, nx1, ...].
+   */
+  estimateNormals3D(points, k = 18, orient = true) {
+    var P = points;
+    if(!(points instanceof Float64Array)) {
+      P = new Float64Array(points.length * 3);
+      for(var i = 0; i < points.length; i++) {
+        P[3*i] = points[i][0];
+        P[3*i+1] = points[i][1];
+        P[3*i+2] = points[i][2];
+      }
+    }
+
+    return this.jsl.inter.env.AlphaShape3D.estimateNormals(P, k, orient);
+  }
+
   /**
    * Writes geometry data to an OFF file.
    * @param {string} filename - The path to the OFF file.
@@ -1072,9 +1230,7 @@ class PRDC_JSLAB_LIB_GEOMETRY {
    * @param {number[][]} faces - Array of face indices.
    */
   writeOff(filename, vertices, faces) {
-    var shp = new this.jsl.inter.env.AlphaShape3D(); 
-    shp.writeOff(filename, vertices, faces);
-    shp = null;
+    this.jsl.inter.env.AlphaShape3D.writeOff(filename, vertices, faces);
   }
 
   /**
@@ -55,6 +55,8 @@ class PRDC_JSLAB_ENV {
     const internal_app_path = this.jsl.app_path;
     const { NativeModule } = require(internal_app_path + '/build/Release/native_module');
     const { AlphaShape3D } = require(internal_app_path + '/build/Release/alpha_shape_3d');
+    const { AlphaShape2D } = require(internal_app_path + '/build/Release/alpha_shape_2d');
+    const { ScatteredInterpolant2D } = require(internal_app_path + '/build/Release/scattered_interpolant_2d');
 
     if(!this.is_worker) {
       this.context = this.runtime_scope;
@@ -89,6 +91,8 @@ class PRDC_JSLAB_ENV {
     }
     this.native_module = new NativeModule();
     this.AlphaShape3D = AlphaShape3D;
+    this.AlphaShape2D = AlphaShape2D;
+    this.ScatteredInterpolant2D = ScatteredInterpolant2D;
     this.bin7zip = bin7zip;
     this.seedRandom = seedrandom;
     this.extractFull = extractFull;
@@ -61,6 +61,18 @@ class PRDC_JSLAB_LIB_MATH {
   seedRandom(...args) {
     return this.jsl.inter.env.seedRandom(...args);
   }
+
+  /**
+   * Creates native seeded random generator that fills arrays in bulk.
+   * Philox generator is counter based, so streams with different index are independent and results do not depend on number of threads.
+   * @param {(number|string)} [seed=0] - Generator seed.
+   * @param {string} [algorithm='philox'] - Generator algorithm ('philox' or 'xoshiro256pp').
+   * @param {number} [stream=0] - Stream index, up to 65535 for 'xoshiro256pp'.
+   * @returns {Object} Generator with rand(n, a, b), randn(n, mu, sigma), randi(n, lo, hi), fill(array, distribution, a, b) and next() methods.
+   */
+  rng(seed = 0, algorithm = 'philox', stream = 0) {
+    return this.jsl.inter.env.native_module.rng(seed, algorithm, stream);
+  }
     
   /**
    * Performs linear interpolation on a set of data points.
@@ -71,53 +83,27 @@ class PRDC_JSLAB_LIB_MATH {
    * @returns {Number|Array} The interpolated y-value(s) at xq.
    */
   interp(x, y, xq, mode = 'none') {
-    // Helper function for scalar interpolation
-    const interpolate = (xqi) => {
-      // Use lastIndexOf to get the last occurrence of an exact match.
-      const i = x.lastIndexOf(xqi);
-      if(i >= 0) {
-        return y[i];
-      }
-
-      // Find the closest points for interpolation
-      let x1 = null, x2 = null;
-      for(let v of x) {
-        if(v < xqi && (x1 === null || v > x1)) {
-          x1 = v;
-        }
-        if(v > xqi && (x2 === null || v < x2)) {
-          x2 = v;
-        }
-      }
-
-      // Handle extrapolation if mode is 'extrap'
-      if(mode === 'extrap') {
-        if(xqi < x[0]) {
-          const gradient = (y[1] - y[0]) / (x[1] - x[0]);
-          return y[0] + (xqi - x[0]) * gradient;
-        } else if(xqi > x[x.length - 1]) {
-          const lastIdx = x.length - 1;
-          const gradient = (y[lastIdx] - y[lastIdx - 1]) / (x[lastIdx] - x[lastIdx - 1]);
-          return y[lastIdx] + (xqi - x[lastIdx]) * gradient;
-        }
-      }
-
-      // Interpolate between x1 and x2
-      if(x1 !== null && x2 !== null && x1 !== x2) {
-        // Use the last occurrence for x1 and the first occurrence for x2
-        const idx1 = x.lastIndexOf(x1);
-        const idx2 = x.indexOf(x2);
-        const y1 = y[idx1];
-        const y2 = y[idx2];
-        return y1 + (xqi - x1) * (y2 - y1) / (x2 - x1);
-      }
-
-      // Return NaN if no valid interpolation point is found
-      return NaN;
-    };
+    return this.interp1(x, y, xq, 'linear', mode === 'extrap' ? 'extrap' : NaN);
+  }
 
-    // If xq is an array, map over each element
-    return Array.isArray(xq) ? xq.map(interpolate) : interpolate(xq);
+  /**
+   * One-dimensional interpolation computed natively, sorted query points are 
+   * located with a single merged walk and unsorted with binary search.
+   * @param {Array|Float64Array} x The x-values of the data points.
+   * @param {Array|Float64Array} y The y-values of the data points, corresponding to each x-value.
+   * @param {Number|Array|Float64Array} xq The x-value(s) for which to interpolate a y-value.
+   * @param {String} [method='linear'] Interpolation method: 'linear', 'nearest', 'previous', 'next', 'pchip' or 'spline'.
+   * @param {String|Number} [extrap=NaN] Values outside of x range: 'extrap' to extrapolate with method, 'clamp' to use end values or fill value.
+   * @returns {Number|Array|Float64Array} The interpolated y-value(s) at xq, Float64Array for Float64Array query points.
+   */
+  interp1(x, y, xq, method = 'linear', extrap = NaN) {
+    var scalar = typeof xq === 'number';
+    var yq = this.jsl.inter.env.native_module.interp1(x, y, 
+      scalar ? [xq] : xq, method, extrap);
+    if(scalar) {
+      return yq[0];
+    }
+    return xq instanceof Float64Array ? yq : Array.from(yq);
   }
 
   /**
@@ -257,152 +243,45 @@ class PRDC_JSLAB_LIB_MATH {
   }
   
   /**
-   * Interpolates grid data using the specified method.
+   * Interpolates scattered data on grid using the specified method. Linear 
+   * and cubic (Clough-Tocher) methods use Delaunay triangulation, nearest 
+   * uses kd-tree and natural uses Sibson natural neighbor coordinates.
+   * Repeated points are merged with mean of their values. Options N_a, k_e,
+   * Ngx and Ngy of former block-wise interpolation are no longer used and
+   * are ignored, whole data set is triangulated once.
    * @param {Array} x - X coordinates.
    * @param {Array} y - Y coordinates.
    * @param {Array} z - Data values.
    * @param {Array} xq - Query X coordinates.
    * @param {Array} yq - Query Y coordinates.
-   * @param {string} [method="linear"] - Interpolation method.
+   * @param {string} [method="linear"] - Interpolation method: 'linear', 'nearest', 'natural' or 'cubic'.
    * @param {Object} [opts_in] - Optional settings.
+   * @param {boolean} [opts_in.extrap=true] - Extrapolate outside of convex hull from gradient at nearest point.
    * @returns {Array[]} Interpolated grid [xq, yq, zq].
    */
   gridData(x, y, z, xq, yq, method = "linear", opts_in) {
     var opts = {
-      N_a: 11,
-      k_e: 0.05,
-      Ngx: 5,
-      Ngy: 1,
       extrap: true,
       ...opts_in
     };
-    
-    function isBetween(A, a, b){
-      var B = [];
-      for(var i = 0; i < A.length; i += 1){
-        if(A[i] >= (a - (b - a) * opts.k_e) && 
-           A[i] <= (b + (b - a) * opts.k_e)) B.push(i);
-      }
-      return B;
+    if(!['linear', 'nearest', 'natural', 'cubic'].includes(method)) {
+      this.jsl.inter.env.error('@gridData: '+this.jsl.inter.lang.string(235));
+      return [xq, yq, undefined];
     }
-
-    var q_ids = [];
-    var i_ids = [];
-
-    var limits_x = this.jsl.inter.array.linspace(xq[0], this.jsl.inter.array.end(xq), opts.Ngx + 1);
-    var limits_y = this.jsl.inter.array.linspace(yq[0], this.jsl.inter.array.end(yq), opts.Ngy + 1);
     
-    for(var i = 0; i < opts.Ngx; i++){
-      var i_idx = isBetween(x, limits_x[i], limits_x[i + 1]);
-      for(var j = 0; j < opts.Ngy; j++){
-        var i_idy = isBetween(y, limits_y[j], limits_y[j + 1]);
-        var i_id = this.jsl.inter.array.arrayIntersect(i_idx, i_idy);
-        i_ids.push(structuredClone(i_id));
-        
-        var q_ids_ij = [];
-        for(var k = 0; k < xq.length; k++){
-          for(var m = 0; m < yq.length; m++){
-            if(limits_x[i] <= xq[k] && 
-                 xq[k] <= limits_x[i + 1] &&
-                 limits_y[j] <= yq[m] && 
-                 yq[m] <= limits_y[j + 1]){
-              q_ids_ij.push([k, m]);
-            } 
-          }
-        }
-        q_ids.push([...q_ids_ij]);
-      }
+    var P = new Float64Array(2 * x.length);
+    for(var i = 0; i < x.length; i++) {
+      P[2*i] = x[i];
+      P[2*i+1] = y[i];
     }
+    var interpolant = new this.jsl.inter.env.ScatteredInterpolant2D();
+    interpolant.newData(P, Float64Array.from(z));
+    var Z = interpolant.interpolateGrid(Float64Array.from(xq), 
+      Float64Array.from(yq), method, opts.extrap);
     
-    // Interpolation
-    var zq = this.jsl.inter.array.NaNs(yq.length, xq.length);
-    if(method == 'nearest') {
-      for(var i = 0; i < q_ids.length; i++) {
-        var gc_q_ids = q_ids[i];
-        var gc_i_ids = i_ids[i];
-        for(var j = 0; j < gc_q_ids.length; j++) {
-          var L_min;
-          for(var k = 0; k < gc_i_ids.length; k++) {
-            var L = Math.sqrt(Math.pow(x[gc_i_ids[k]] - xq[gc_q_ids[j][0]], 2) + 
-                              Math.pow(y[gc_i_ids[k]] - yq[gc_q_ids[j][1]], 2));
-            if(k == 0 || L < L_min){
-              L_min = L;
-              zq[gc_q_ids[j][1]][gc_q_ids[j][0]] = z[gc_i_ids[k]];
-            }
-          }
-        }
-      }
-    } else if(method == 'linear') {
-      for(var i = 0; i < q_ids.length; i++) {
-        var gc_q_ids = q_ids[i];
-        var gc_i_ids = i_ids[i];
-        
-        // Delaunay triangulation
-        var points = [];
-        for(var j = 0; j < gc_i_ids.length; j++) {
-          points.push([x[gc_i_ids[j]], y[gc_i_ids[j]], z[gc_i_ids[j]]]);
-        }
-        var triangles = this.jsl.inter.geometry.delaunayTriangulation(points);
-        
-        // Locate point (xq, yq) in triangle and calculate zq
-        for(var j = 0; j < gc_q_ids.length; j++) {
-          var point = [xq[gc_q_ids[j][0]], yq[gc_q_ids[j][1]], 0];
-          for(var k = 0; k < triangles.length; k++) {
-           if(triangles[k].contains(point)) {
-             zq[gc_q_ids[j][1]][gc_q_ids[j][0]] = triangles[k].valueAt(point);
-             break; 
-           }
-          }
-        }        
-      }
-
-      if(opts.extrap) {
-        // Extrapolation
-        var zq0 = structuredClone(zq);
-        
-        // Calculate dz/dx and dz/dy for grid
-        var [dz_x, dz_y] = this.gridGradient(xq, yq, zq, opts.N_a);
-        
-        for(var i = 0; i < q_ids.length; i++) {
-          var gc_q_ids = q_ids[i];
-          
-          // Find nearest point with dz/dx and dz/dy
-          for(var j = 0; j < gc_q_ids.length; j++) {
-            var point = [
-              xq[gc_q_ids[j][0]], 
-              yq[gc_q_ids[j][1]], 
-              zq[gc_q_ids[j][1]][gc_q_ids[j][0]]
-             ];
-            if(this.jsl._isNaN(point[2])) {
-              var L_min;
-              var k_min = -1;
-              for(var k = 0; k < gc_q_ids.length; k++) {
-                if(!this.jsl._isNaN(zq0[gc_q_ids[k][1]][gc_q_ids[k][0]])) {
-                  var L = Math.sqrt(Math.pow(point[0] - xq[gc_q_ids[k][0]], 2) + 
-                                   Math.pow(point[1] - yq[gc_q_ids[k][1]], 2));
-                  if(k_min == -1 || L < L_min){
-                    L_min = L;
-                    k_min = k;
-                  }
-                }
-              }
-              if(k_min >= 0) {
-                // Calculate dz and z
-                var dz_x_i = dz_x[gc_q_ids[k_min][1]][gc_q_ids[k_min][0]];
-                var dz_y_i = dz_y[gc_q_ids[k_min][1]][gc_q_ids[k_min][0]];
-                
-                var dx = xq[gc_q_ids[k_min][0]] - point[0];
-                var dy = yq[gc_q_ids[k_min][1]] - point[1];
-                zq[gc_q_ids[j][1]][gc_q_ids[j][0]] = 
-                  zq[gc_q_ids[k_min][1]][gc_q_ids[k_min][0]] - 
-                  dx * dz_x_i - dy * dz_y_i;
-              }
-            }
-          }
-        }
-      }
-    } else {
-      this.jsl.inter.env.error('@gridData: '+this.jsl.inter.lang.string(235));
+    var zq = [];
+    for(var j = 0; j < yq.length; j++) {
+      zq.push(Array.from(Z.subarray(j * xq.length, (j + 1) * xq.length)));
     }
     return [xq, yq, zq];
   }
@@ -881,33 +760,444 @@ class PRDC_JSLAB_LIB_MATH {
 
   /**
    * Fits a polynomial of degree n to the given data points and returns the coefficients (highest degree first).
-   * @param {number[]} x - The array of x-values.
-   * @param {number[]} y - The array of y-values corresponding to each x-value.
+   * @param {number[]|Float64Array} x - The array of x-values.
+   * @param {number[]|Float64Array} y - The array of y-values corresponding to each x-value.
    * @param {number} n - The degree of the polynomial to fit.
    * @returns {number[]} The coefficients of the fitted polynomial in descending order.
    */
   polyfit(x, y, n) {
-    var p = new this.jsl.inter.env.PolynomialRegression(x, y, n);
-    return p.coefficients.reverse(); // Reverse to match MATLAB's coefficient order
+    return Array.from(this.jsl.inter.env.native_module.polyfit(x, y, n).p);
+  }
+
+  /**
+   * Fits a polynomial natively with column pivoting QR and returns error estimate structure and optional centering and scaling.
+   * @param {number[]|Float64Array} x - The array of x-values.
+   * @param {number[]|Float64Array} y - The array of y-values corresponding to each x-value.
+   * @param {number} n - The degree of the polynomial to fit.
+   * @param {boolean} [center=false] - Fit in terms of (x - mu[0]) / mu[1] where mu holds mean and standard deviation of x.
+   * @returns {Array} Coefficients p, structure S with triangular factor R, degrees of freedom df, norm of residuals normr and rank, and mu (null if not centered).
+   */
+  polyfitFull(x, y, n, center = false) {
+    var fit = this.jsl.inter.env.native_module.polyfit(x, y, n, center);
+    var np = fit.p.length;
+    var R = [];
+    for(var i = 0; i < np; i++) {
+      R.push([]);
+      for(var j = 0; j < np; j++) {
+        R[i].push(fit.R[j * np + i]);
+      }
+    }
+    var S = { R: R, df: fit.df, normr: fit.normr, rank: fit.rank };
+    return [Array.from(fit.p), S, fit.mu ? Array.from(fit.mu) : null];
+  }
+
+  /**
+   * Fits polynomials of degree n to many data columns sampled at the same x-values, Vandermonde matrix is factorized once.
+   * @param {number[]|Float64Array} x - The array of x-values.
+   * @param {number[][]|Float64Array} Y - Array of y-value columns or flat columns one after another.
+   * @param {number} n - The degree of the polynomials to fit.
+   * @param {boolean} [center=false] - Fit in terms of (x - mu[0]) / mu[1] where mu holds mean and standard deviation of x.
+   * @returns {Object} Object with flat coefficients P (n+1 per column, highest degree first), normr of each column, df, rank and mu.
+   */
+  polyfitBatch(x, Y, n, center = false) {
+    var y = Y;
+    if(Array.isArray(Y) && Y.length && typeof Y[0] !== 'number') {
+      var m = x.length;
+      y = new Float64Array(Y.length * m);
+      for(var k = 0; k < Y.length; k++) {
+        y.set(Y[k], k * m);
+      }
+    }
+    return this.jsl.inter.env.native_module.polyfitBatch(x, y, n, center);
+  }
+
+  /**
+   * Evaluates a polynomial with given coefficients at specified x-values using native Horner scheme.
+   * @param {number[]|Float64Array} p - The coefficients of the polynomial in descending order.
+   * @param {number|number[]|Float64Array} x_in - The x-value(s) at which to evaluate the polynomial.
+   * @param {Object} [S] - Structure from polyfitFull, when given standard error estimates are also returned.
+   * @param {number[]} [mu] - Centering and scaling [mean, std] from polyfitFull.
+   * @returns {number|number[]|Float64Array|Array} The resulting y-values (Float64Array for Float64Array input), or [y, delta] when S is given.
+   */
+  polyval(p, x_in, S, mu) {
+    var scalar = typeof x_in === 'number';
+    var x = scalar ? [x_in] : x_in;
+    var result;
+    if(S) {
+      var np = p.length;
+      var R = S.R;
+      if(Array.isArray(R)) {
+        R = new Float64Array(np * np);
+        for(var i = 0; i < np; i++) {
+          for(var j = 0; j < np; j++) {
+            R[j * np + i] = S.R[i][j];
+          }
+        }
+      }
+      result = this.jsl.inter.env.native_module.polyval(p, x, mu, R, 
+        S.df, S.normr);
+    } else {
+      result = { y: this.jsl.inter.env.native_module.polyval(p, x, mu) };
+    }
+    var convert = function(v) {
+      if(scalar) {
+        return v[0];
+      }
+      return x_in instanceof Float64Array ? v : Array.from(v);
+    };
+    if(S) {
+      return [convert(result.y), convert(result.delta)];
+    }
+    return convert(result.y);
+  }
+
+  /**
+   * Evaluates many polynomials of the same degree at the same x-values using native Horner scheme.
+   * @param {number[][]|Float64Array} P - Array of coefficient arrays or flat coefficients one polynomial after another.
+   * @param {number[]|Float64Array} x - The x-values at which to evaluate the polynomials.
+   * @param {number[]} [mu] - Centering and scaling [mean, std] from polyfitBatch.
+   * @param {number} [np] - Number of coefficients of each polynomial, required for flat coefficients.
+   * @returns {Float64Array} Values of each polynomial at x one polynomial after another.
+   */
+  polyvalBatch(P, x, mu, np) {
+    var c = P;
+    if(Array.isArray(P) && P.length && typeof P[0] !== 'number') {
+      np = P[0].length;
+      c = new Float64Array(P.length * np);
+      for(var k = 0; k < P.length; k++) {
+        c.set(P[k], k * np);
+      }
+    }
+    return this.jsl.inter.env.native_module.polyvalBatch(c, np, x, mu);
+  }
+
+  /**
+   * Computes discrete Fourier transform natively with cached mixed radix plans (Bluestein for large prime factors), complementing mathjs fft for typed data.
+   * @param {number[]|Float64Array} re - Real part of input.
+   * @param {number[]|Float64Array} [im] - Imaginary part of input, omitted for real input.
+   * @param {number} [n] - Transform length, input is zero padded or truncated.
+   * @returns {Object} Object with real part re and imaginary part im as Float64Arrays.
+   */
+  fft1d(re, im, n) {
+    return this.jsl.inter.env.native_module.fft(re, im, n, false);
+  }
+
+  /**
+   * Computes inverse discrete Fourier transform natively, scaled by 1/n.
+   * @param {number[]|Float64Array} re - Real part of input.
+   * @param {number[]|Float64Array} [im] - Imaginary part of input.
+   * @param {number} [n] - Transform length, input is zero padded or truncated.
+   * @returns {Object} Object with real part re and imaginary part im as Float64Arrays.
+   */
+  ifft1d(re, im, n) {
+    return this.jsl.inter.env.native_module.fft(re, im, n, true);
+  }
+
+  /**
+   * Computes discrete Fourier transform of real data, returning only n/2+1 nonnegative frequency terms.
+   * @param {number[]|Float64Array} x - Real input data.
+   * @param {number} [n] - Transform length, input is zero padded or truncated.
+   * @returns {Object} Object with real part re and imaginary part im as Float64Arrays.
+   */
+  rfft(x, n) {
+    return this.jsl.inter.env.native_module.rfft(x, n);
+  }
+
+  /**
+   * Computes inverse of rfft, returning real data of length n.
+   * @param {number[]|Float64Array} re - Real part of nonnegative frequency terms.
+   * @param {number[]|Float64Array} im - Imaginary part of nonnegative frequency terms.
+   * @param {number} [n] - Output length, defaults to 2*(re.length-1).
+   * @returns {Float64Array} Real output data.
+   */
+  irfft(re, im, n) {
+    return this.jsl.inter.env.native_module.irfft(re, im, n);
+  }
+
+  /**
+   * Computes two-dimensional discrete Fourier transform natively.
+   * @param {Array[]} re - Real part as array of rows.
+   * @param {Array[]} [im] - Imaginary part as array of rows.
+   * @param {boolean} [inverse=false] - Compute inverse transform scaled by 1/(rows*cols).
+   * @returns {Object} Object with real part re and imaginary part im as arrays of Float64Array rows.
+   */
+  fft2d(re, im, inverse = false) {
+    var rows = re.length;
+    var cols = rows ? re[0].length : 0;
+    var flat = function(A) {
+      var a = new Float64Array(rows * cols);
+      for(var i = 0; i < rows; i++) {
+        for(var j = 0; j < cols; j++) {
+          a[j * rows + i] = A[i][j];
+        }
+      }
+      return a;
+    };
+    var X = this.jsl.inter.env.native_module.fft2(flat(re), 
+      im ? flat(im) : null, rows, cols, inverse);
+    var unflat = function(a) {
+      var A = [];
+      for(var i = 0; i < rows; i++) {
+        var row = new Float64Array(cols);
+        for(var j = 0; j < cols; j++) {
+          row[j] = a[j * rows + i];
+        }
+        A.push(row);
+      }
+      return A;
+    };
+    return { re: unflat(X.re), im: unflat(X.im) };
+  }
+
+  /**
+   * Returns spectral analysis window.
+   * @param {number|string|number[]|Float64Array} window - Window values, window length for Hamming window or window name ('hamming', 'hann' or 'rectangular').
+   * @param {number} L - Window length used with window name.
+   * @returns {Float64Array} Window values.
+   */
+  _spectralWindow(window, L) {
+    if(typeof window === 'number') {
+      L = window;
+      window = 'hamming';
+    }
+    if(typeof window !== 'string') {
+      return Float64Array.from(window);
+    }
+    // Generalized cosine window w = a0 - a1*cos(2*pi*k/(L-1))
+    var windows = {
+      hamming: [0.54, 0.46],
+      hann: [0.5, 0.5],
+      rectangular: [1, 0]
+    };
+    if(!Object.hasOwn(windows, window)) {
+      this.jsl.inter.env.error('@_spectralWindow: '+this.jsl.inter.lang.string(235));
+      return;
+    }
+    var [a0, a1] = windows[window];
+    var w = new Float64Array(L);
+    for(var k = 0; k < L; k++) {
+      var c = L > 1 ? Math.cos(2 * Math.PI * k / (L - 1)) : 1;
+      w[k] = a0 - a1 * c;
+    }
+    return w;
+  }
+
+  /**
+   * Returns default number of FFT points for segment length L.
+   * @param {number} L - Segment length.
+   * @returns {number} Larger of 256 and next power of two of L.
+   */
+  _spectralNfft(L) {
+    return Math.max(256, Math.pow(2, Math.ceil(Math.log2(Math.max(1, L)))));
+  }
+
+  /**
+   * Estimates one-sided power spectral density with Welch's averaged periodogram method.
+   * @param {number[]|Float64Array} x - Input signal.
+   * @param {number|string|number[]|Float64Array} [window] - Window, defaults to Hamming window giving 8 segments with 50% overlap.
+   * @param {number} [noverlap] - Number of overlapping samples, defaults to 50% of window.
+   * @param {number} [nfft] - Number of FFT points, defaults to max(256, 2^nextpow2(L)).
+   * @param {number} [fs=1] - Sampling frequency.
+   * @returns {Array} Power spectral density pxx and frequencies f as Float64Arrays.
+   */
+  pwelch(x, window, noverlap, nfft, fs = 1) {
+    var N = x.length;
+    if(window === undefined || window === null) {
+      window = Math.floor(N / 4.5);
+    }
+    var w = this._spectralWindow(window, N);
+    var L = w.length;
+    if(noverlap === undefined || noverlap === null) {
+      noverlap = Math.floor(L / 2);
+    }
+    if(nfft === undefined || nfft === null) {
+      nfft = this._spectralNfft(L);
+    }
+    var pxx = this.jsl.inter.env.native_module.pwelch(x, w, noverlap, nfft, fs);
+    return [pxx, this._spectralFrequencies(nfft, fs)];
+  }
+
+  /**
+   * Estimates one-sided power spectral density with periodogram.
+   * @param {number[]|Float64Array} x - Input signal.
+   * @param {string|number[]|Float64Array} [window='rectangular'] - Window of signal length.
+   * @param {number} [nfft] - Number of FFT points, defaults to max(256, 2^nextpow2(N)), windowed signal longer than nfft is wrapped as in MATLAB.
+   * @param {number} [fs=1] - Sampling frequency.
+   * @returns {Array} Power spectral density pxx and frequencies f as Float64Arrays.
+   */
+  periodogram(x, window = 'rectangular', nfft, fs = 1) {
+    var N = x.length;
+    var w = this._spectralWindow(window || 'rectangular', N);
+    if(nfft === undefined || nfft === null) {
+      nfft = this._spectralNfft(N);
+    }
+    var pxx;
+    if(nfft < N) {
+      // Sum nfft long blocks of windowed signal, rectangular window of 
+      // nfft points is then rescaled to window power
+      var xw = new Float64Array(nfft);
+      var U = 0;
+      for(var k = 0; k < N; k++) {
+        xw[k % nfft] += x[k] * w[k];
+        U += w[k] * w[k];
+      }
+      pxx = this.jsl.inter.env.native_module.pwelch(xw, 
+        new Float64Array(nfft).fill(1), 0, nfft, fs);
+      for(var k = 0; k < pxx.length; k++) {
+        pxx[k] *= nfft / U;
+      }
+    } else {
+      pxx = this.jsl.inter.env.native_module.pwelch(x, w, 0, nfft, fs);
+    }
+    return [pxx, this._spectralFrequencies(nfft, fs)];
   }
 
   /**
-   * Evaluates a polynomial with given coefficients at specified x-values.
-   * @param {number[]} p - The coefficients of the polynomial in descending order.
-   * @param {number[]} x_in - The array of x-values at which to evaluate the polynomial.
-   * @returns {number[]} The resulting y-values after evaluating the polynomial at x_in.
+   * Computes spectrogram with short-time Fourier transform.
+   * @param {number[]|Float64Array} x - Input signal.
+   * @param {number|string|number[]|Float64Array} [window] - Window, defaults to Hamming window giving 8 segments with 50% overlap.
+   * @param {number} [noverlap] - Number of overlapping samples, defaults to 50% of window.
+   * @param {number} [nfft] - Number of FFT points, defaults to max(256, 2^nextpow2(L)).
+   * @param {number} [fs=1] - Sampling frequency.
+   * @returns {Array} Short-time transform S (object with re and im), frequencies f, segment center times t and power spectral density P, S and P are column-major with f.length rows and t.length columns.
    */
-  polyval(p, x_in) {
-    var y_out = [];
-    y_out.length = x_in.length;
-    for(var k = 0; k < x_in.length; k++) {
-      var y = p[0];
-      for(var i = 1; i < p.length; i++) {
-        y = y * x_in[k] + p[i];
+  spectrogram(x, window, noverlap, nfft, fs = 1) {
+    var N = x.length;
+    if(window === undefined || window === null) {
+      window = Math.floor(N / 4.5);
+    }
+    var w = this._spectralWindow(window, N);
+    var L = w.length;
+    if(noverlap === undefined || noverlap === null) {
+      noverlap = Math.floor(L / 2);
+    }
+    if(nfft === undefined || nfft === null) {
+      nfft = this._spectralNfft(L);
+    }
+    var S = this.jsl.inter.env.native_module.stft(x, w, noverlap, nfft);
+    var U = 0;
+    for(var k = 0; k < L; k++) {
+      U += w[k] * w[k];
+    }
+    var P = new Float64Array(S.re.length);
+    for(var j = 0; j < S.cols; j++) {
+      for(var k = 0; k < S.rows; k++) {
+        var i = j * S.rows + k;
+        var edge = k === 0 || (nfft % 2 === 0 && k === S.rows - 1);
+        P[i] = (S.re[i] * S.re[i] + S.im[i] * S.im[i]) / (fs * U) * 
+          (edge ? 1 : 2);
       }
-      y_out[k] = y;
     }
-    return y_out;
+    var t = new Float64Array(S.cols);
+    for(var j = 0; j < S.cols; j++) {
+      t[j] = (j * (L - noverlap) + L / 2) / fs;
+    }
+    return [{ re: S.re, im: S.im }, this._spectralFrequencies(nfft, fs), t, P];
+  }
+
+  /**
+   * Returns frequencies of one-sided spectrum.
+   * @param {number} nfft - Number of FFT points.
+   * @param {number} fs - Sampling frequency.
+   * @returns {Float64Array} Frequencies of nfft/2+1 bins.
+   */
+  _spectralFrequencies(nfft, fs) {
+    var f = new Float64Array(Math.floor(nfft / 2) + 1);
+    for(var k = 0; k < f.length; k++) {
+      f[k] = k * fs / nfft;
+    }
+    return f;
+  }
+
+  /**
+   * Converts native result to type of input data.
+   * @param {Float64Array} y - Native result.
+   * @param {number[]|Float64Array} x - Input data.
+   * @returns {number[]|Float64Array} Float64Array for typed input and Array otherwise.
+   */
+  _signalOutput(y, x) {
+    return ArrayBuffer.isView(x) ? y : Array.from(y);
+  }
+
+  /**
+   * Filters data with rational transfer function b/a natively as direct form II transposed, complementing mathjs filter.
+   * @param {number[]|Float64Array} b - Numerator coefficients.
+   * @param {number[]|Float64Array} a - Denominator coefficients.
+   * @param {number[]|Float64Array} x - Input data, for multiple channels column-major with channels columns.
+   * @param {number[]|Float64Array} [zi] - Initial conditions, max(length(a), length(b))-1 per channel, when given final conditions are also returned.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number[]|Float64Array|Array} Filtered data, or [y, zf] when zi is given.
+   */
+  filter1d(b, a, x, zi, channels = 1) {
+    var result = this.jsl.inter.env.native_module.filter(b, a, x, channels, zi);
+    var y = this._signalOutput(result.y, x);
+    if(zi !== undefined && zi !== null) {
+      return [y, this._signalOutput(result.zf, zi)];
+    }
+    return y;
+  }
+
+  /**
+   * Zero-phase digital filtering by processing data forward and backward.
+   * @param {number[]|Float64Array} b - Numerator coefficients.
+   * @param {number[]|Float64Array} a - Denominator coefficients.
+   * @param {number[]|Float64Array} x - Input data longer than 3 times filter order, for multiple channels column-major with channels columns.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number[]|Float64Array} Filtered data.
+   */
+  filtfilt(b, a, x, channels = 1) {
+    return this._signalOutput(
+      this.jsl.inter.env.native_module.filtfilt(b, a, x, channels), x);
+  }
+
+  /**
+   * Convolution computed natively, directly for short operands and with FFT otherwise.
+   * @param {number[]|Float64Array} u - Input data, for multiple channels column-major with channels columns.
+   * @param {number[]|Float64Array} v - Convolution kernel.
+   * @param {string} [shape='full'] - Part of convolution: 'full', 'same' or 'valid'.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number[]|Float64Array} Convolution of each channel with v.
+   */
+  conv(u, v, shape = 'full', channels = 1) {
+    return this._signalOutput(
+      this.jsl.inter.env.native_module.conv(u, v, shape, channels), u);
+  }
+
+  /**
+   * Deconvolution and polynomial division.
+   * @param {number[]|Float64Array} b - Dividend, for multiple channels column-major with channels columns.
+   * @param {number[]|Float64Array} a - Divisor.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {Array} Quotient q and remainder r so that b = conv(a, q) + r.
+   */
+  deconv(b, a, channels = 1) {
+    var result = this.jsl.inter.env.native_module.deconv(b, a, channels);
+    return [this._signalOutput(result.q, b), this._signalOutput(result.r, b)];
+  }
+
+  /**
+   * Decreases sample rate by integer factor r after zero-phase FIR lowpass filtering.
+   * @param {number[]|Float64Array} x - Input data longer than 90 samples, for multiple channels column-major with channels columns.
+   * @param {number} r - Decimation factor.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number[]|Float64Array} Decimated data with ceil(N/r) samples per channel.
+   */
+  decimate(x, r, channels = 1) {
+    return this._signalOutput(
+      this.jsl.inter.env.native_module.decimate(x, r, channels), x);
+  }
+
+  /**
+   * Changes sample rate by factor p/q with polyphase anti-aliasing FIR filter.
+   * @param {number[]|Float64Array} x - Input data, for multiple channels column-major with channels columns.
+   * @param {number} p - Upsampling factor.
+   * @param {number} q - Downsampling factor.
+   * @param {number} [channels=1] - Number of channels.
+   * @returns {number[]|Float64Array} Resampled data with ceil(N*p/q) samples per channel.
+   */
+  resample(x, p, q, channels = 1) {
+    return this._signalOutput(
+      this.jsl.inter.env.native_module.resample(x, p, q, channels), x);
   }
 
   /**
@@ -919,6 +1209,32 @@ class PRDC_JSLAB_LIB_MATH {
     return this.jsl.inter.env.native_module.roots(p);
   }
 
+  /**
+   * Computes the roots of many polynomials in parallel.
+   * @param {number[][]|Float64Array} P - Array of coefficient arrays (highest degree first) or flat coefficients.
+   * @param {Uint32Array|number[]} [offsets] - Start of each polynomial in flat coefficients, followed by total length.
+   * @param {string} [method='aberth'] - Root finding method, 'aberth' (O(n^2)) or 'eig' (companion matrix).
+   * @returns {Object} Object with real and imag Float64Arrays of roots and offsets of roots of each polynomial.
+   */
+  rootsBatch(P, offsets, method = 'aberth') {
+    if(typeof offsets === 'string') {
+      method = offsets;
+      offsets = undefined;
+    }
+    var c = P;
+    if(!offsets) {
+      offsets = new Uint32Array(P.length + 1);
+      for(var k = 0; k < P.length; k++) {
+        offsets[k+1] = offsets[k] + P[k].length;
+      }
+      c = new Float64Array(offsets[P.length]);
+      for(var k = 0; k < P.length; k++) {
+        c.set(P[k], offsets[k]);
+      }
+    }
+    return this.jsl.inter.env.native_module.rootsBatch(c, offsets, method);
+  }
+
   /**
    * Generates a string representation of a polynomial based on the provided coefficients and options.
    * @param {number[]} p - An array of polynomial coefficients, ordered from highest degree to constant term.
@@ -1265,20 +1581,90 @@ class PRDC_JSLAB_LIB_MATH {
   
   /**
    * Performs cumulative trapezoidal integration on the provided data.
-   * @param {...any} args - Arguments required for cumulative trapezoidal integration.
+   * Float64Array inputs are read in place and give Float64Array result.
+   * For a matrix, columns (dim 0) or rows (dim 1) are integrated in parallel.
+   * @param {Array|Float64Array|PRDC_JSLAB_MATRIX} y - Values to integrate.
+   * @param {Array|Float64Array} [x] - Sample points, unit spacing if omitted.
+   * @param {number} [dim=0] - Dimension for matrix input.
+   * @param {Float64Array} [out] - Preallocated output for array input, filled and returned.
    * @returns {any} The result of the cumulative trapezoidal integration.
    */
-  cumtrapz(...args) {
-    return this.jsl.inter.env.native_module.cumtrapz(...args);
+  cumtrapz(y, x, dim, out) {
+    if(this.jsl.inter.mat.isMatrix(y)) {
+      return this._integrateMatrix('cumtrapzMatrix', y, x, dim);
+    }
+    return this.jsl.inter.env.native_module.cumtrapz(y, x, out);
   }
   
   /**
    * Performs trapezoidal integration on the provided data.
-   * @param {...any} args - Arguments required for trapezoidal integration.
+   * Float64Array inputs are read in place.
+   * For a matrix, columns (dim 0) or rows (dim 1) are integrated in parallel.
+   * @param {Array|Float64Array|PRDC_JSLAB_MATRIX} y - Values to integrate.
+   * @param {Array|Float64Array} [x] - Sample points, unit spacing if omitted.
+   * @param {number} [dim=0] - Dimension for matrix input.
    * @returns {any} The result of the trapezoidal integration.
    */
-  trapz(...args) {
-    return this.jsl.inter.env.native_module.trapz(...args);
+  trapz(y, x, dim) {
+    if(this.jsl.inter.mat.isMatrix(y)) {
+      return this._integrateMatrix('trapzMatrix', y, x, dim);
+    }
+    return this.jsl.inter.env.native_module.trapz(y, x);
+  }
+  
+  /**
+   * Performs integration using composite Simpson's rule, for odd number
+   * of intervals the last interval uses the preceding quadratic.
+   * @param {Array|Float64Array|PRDC_JSLAB_MATRIX} y - Values to integrate.
+   * @param {Array|Float64Array} [x] - Sample points, unit spacing if omitted.
+   * @param {number} [dim=0] - Dimension for matrix input.
+   * @returns {number|PRDC_JSLAB_MATRIX} The result of the integration.
+   */
+  simpson(y, x, dim) {
+    if(this.jsl.inter.mat.isMatrix(y)) {
+      return this._integrateMatrix('simpsonMatrix', y, x, dim);
+    }
+    var Y = Float64Array.from(y);
+    return this.jsl.inter.env.native_module.simpsonMatrix(Y, Y.length, 1, x)[0];
+  }
+  
+  /**
+   * Performs cumulative integration using Simpson's rule.
+   * @param {Array|Float64Array|PRDC_JSLAB_MATRIX} y - Values to integrate.
+   * @param {Array|Float64Array} [x] - Sample points, unit spacing if omitted.
+   * @param {number} [dim=0] - Dimension for matrix input.
+   * @returns {Array|Float64Array|PRDC_JSLAB_MATRIX} The cumulative integral.
+   */
+  cumsimpson(y, x, dim) {
+    if(this.jsl.inter.mat.isMatrix(y)) {
+      return this._integrateMatrix('cumsimpsonMatrix', y, x, dim);
+    }
+    var Y = Float64Array.from(y);
+    var I = this.jsl.inter.env.native_module.cumsimpsonMatrix(Y, Y.length, 1, x);
+    return y instanceof Float64Array ? I : Array.from(I);
+  }
+  
+  /**
+   * Integrates a matrix along a dimension using native method.
+   * @param {string} method - Name of native method.
+   * @param {PRDC_JSLAB_MATRIX} A - Matrix to integrate.
+   * @param {Array|Float64Array} [x] - Sample points.
+   * @param {number} [dim=0] - Dimension (0 for columns, 1 for rows).
+   * @returns {PRDC_JSLAB_MATRIX} The result matrix.
+   */
+  _integrateMatrix(method, A, x, dim = 0) {
+    var I = this.jsl.inter.env.native_module[method](
+      Float64Array.from(A.data), A.rows, A.cols, x, dim);
+    var rows = A.rows;
+    var cols = A.cols;
+    if(!method.startsWith('cum')) {
+      if(dim == 0) {
+        rows = 1;
+      } else {
+        cols = 1;
+      }
+    }
+    return this.jsl.inter.mat.new(Array.from(I), rows, cols);
   }
   
   /**
@@ -1320,22 +1706,9 @@ class PRDC_JSLAB_LIB_MATH {
       throw new Error(this.jsl.inter.lang.string(271));
     }
     
-    if(n == 1) {
-      return [1, -matrix[0][0]];
-    }
-    
-    let p = this.jsl.inter.array.ones(n+1);
-    let a1 = [...matrix];
-    for(let k = 2; k <= n; k++) {
-      p[k-1] = -1 * this.jsl.inter.env.math.sum(this.jsl.inter.env.math.diag(a1)) / (k - 1);
-      a1 = this.jsl.inter.env.math.multiply(matrix, this.jsl.inter.array.plus(a1, 
-        this.jsl.inter.env.math.multiply(p[k-1], 
-        this.jsl.inter.env.math.diag(this.jsl.inter.array.ones(n)))));
-    }
-
-    p[n] = -1 * this.jsl.inter.env.math.sum(this.jsl.inter.env.math.diag(a1)) / n;
-
-    return p;
+    // Characteristic polynomial of transpose is the same, row-major data is used
+    return Array.from(this.jsl.inter.env.native_module.charpoly(
+      Float64Array.from(matrix.flat()), n));
   }
 }
 
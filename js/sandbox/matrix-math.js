@@ -17,6 +17,9 @@ class PRDC_JSLAB_MATRIX_MATH {
    */
   constructor(jsl) {
     this.jsl = jsl;
+    
+    // Number of multiply-add operations above which native routines are used
+    this.native_threshold = 32768;
   }
   
   /**
@@ -104,6 +107,19 @@ class PRDC_JSLAB_MATRIX_MATH {
       this.jsl.inter.array.diag(this.jsl.inter.array.ones(size), size), size, size);
   }
   
+  /**
+   * Creates a native sparse matrix from coordinate triplets, duplicates are summed.
+   * @param {Array|Float64Array} I - Zero-based row indices.
+   * @param {Array|Float64Array} J - Zero-based column indices.
+   * @param {Array|Float64Array} V - Values.
+   * @param {number} rows - Number of rows.
+   * @param {number} cols - Number of columns.
+   * @returns {Object} Native sparse matrix with multiply, solve ('ldlt', 'lu', 'cg', 'bicgstab'), toDense and getTriplets methods.
+   */
+  sparse(I, J, V, rows, cols) {
+    return this.jsl.inter.env.native_module.sparse(I, J, V, rows, cols);
+  }
+  
   /**
    * Concatenates multiple matrices vertically (row-wise).
    * @param {...PRDC_JSLAB_MATRIX} args - Matrices to concatenate.
@@ -114,13 +130,14 @@ class PRDC_JSLAB_MATRIX_MATH {
     var cols = args[0].cols;
     var rows = args.reduce((a, e) => a += e.rows, 0);
     var A = new Array(cols * rows).fill(0);
+    var data = args.map((a) => a.data);
     
     var p = 0;
     for(var j = 0; j < cols; j++) {
       for(var k = 0; k < N; k++) {  
-        var P = args[k].data.length / cols;
+        var P = data[k].length / cols;
         for(var i = 0; i < P; i++) {
-          A[p++] = args[k].data[j*P+i];
+          A[p++] = data[k][j*P+i];
         }
       }
     }
@@ -134,10 +151,32 @@ class PRDC_JSLAB_MATRIX_MATH {
    */
   concatCol(...args) {
     var rows = args[0].rows;
-    var A = args.map((a) => a.data).flat();
+    var A = args.map((a) => Array.from(a.data)).flat();
     return this.new(A, rows, A.length / rows);
   }
 
+  /**
+   * Creates a native dense array with shape and strides, Float64Array data is shared without copy.
+   * @param {(Float64Array|Array)} data - Elements, stored column-major by default.
+   * @param {Array<number>} [shape] - Size of each dimension.
+   * @param {Array<number>} [strides] - Distance in elements between neighbours along each dimension.
+   * @param {number} [offset=0] - Index of first element in data.
+   * @returns {Object} Native array with view, permute, reshape, gather, scatter, apply, map and copy methods.
+   */
+  ndarray(data, shape, strides, offset = 0) {
+    return this.jsl.inter.env.native_module.ndarray(data, shape, strides, offset);
+  }
+
+  /**
+   * Checks if the provided object is a native dense array.
+   * @param {Object} A - The object to check.
+   * @returns {boolean} True if A is a native array, else false.
+   */
+  isNativeArray(A) {
+    return typeof A === 'object' && A !== null && 
+      typeof A.getStrides === 'function' && typeof A.gather === 'function';
+  }
+
   /**
    * Checks if the provided object is a matrix.
    * @param {Object} A - The object to check.
@@ -158,12 +197,14 @@ class PRDC_JSLAB_MATRIX {
   #jsl;
   #rows;
   #cols;
+  #data;
+  #native = null;
   
   /**
    * Constructs a JSLAB matrix.
    * @constructor
    * @param {Object} jsl - Reference to the main JSLAB object.
-   * @param {Array} A - The matrix data.
+   * @param {Array|Object} A - The matrix data or native array to wrap.
    * @param {number} rows - Number of rows.
    * @param {number} cols - Number of columns.
    */
@@ -179,6 +220,17 @@ class PRDC_JSLAB_MATRIX {
    * @param {number} cols - Number of columns.
    */
   _set(A, rows, cols) {
+    if(this.#jsl.inter.mat.isNativeArray(A)) {
+      var shape = A.getShape();
+      if(shape.length > 2) {
+        this.#jsl.inter.env.error('@matrix: '+this.#jsl.inter.lang.string(537));
+      }
+      this.rows = shape[0];
+      this.cols = shape.length > 1 ? shape[1] : 1;
+      this.#data = null;
+      this.#native = A;
+      return;
+    }
     this.rows = rows;
     this.cols = cols;
     if(!rows) {
@@ -194,12 +246,132 @@ class PRDC_JSLAB_MATRIX {
     }
   }
 
+  /**
+   * Matrix elements in column-major order. For native backed matrices writes always reach the native array, contiguous data is shared Float64Array and strided views return live accessor over shared buffer.
+   * @type {Array|Float64Array}
+   */
+  get data() {
+    if(this.#native) {
+      var buffer = this.#native.buffer();
+      if(this.#native.isContiguous() && this.#native.getOffset() === 0 &&
+          buffer.length === this.rows * this.cols) {
+        return buffer;
+      }
+      return this.#stridedData(buffer);
+    }
+    return this.#data;
+  }
+
+  set data(A) {
+    this.#native = null;
+    this.#data = A;
+  }
+
+  /**
+   * Creates array-like accessor mapping column-major index to element of strided native view.
+   * @param {Float64Array} buffer - Buffer shared by native view.
+   * @returns {Array} Proxy reading and writing elements of the view in place.
+   */
+  #stridedData(buffer) {
+    var [s0, s1] = this.#native.getStrides();
+    var offset = this.#native.getOffset();
+    var rows = this.rows;
+    var n = this.rows * this.cols;
+    var index = function(prop) {
+      if(typeof prop !== 'string') {
+        return -1;
+      }
+      var k = Number(prop);
+      if(!Number.isInteger(k) || k < 0 || k >= n || String(k) !== prop) {
+        return -1;
+      }
+      return offset + (k % rows) * s0 + Math.floor(k / rows) * s1;
+    };
+    return new Proxy(new Array(n), {
+      get(target, prop, receiver) {
+        var i = index(prop);
+        return i >= 0 ? buffer[i] : Reflect.get(target, prop, receiver);
+      },
+      set(target, prop, value, receiver) {
+        var i = index(prop);
+        if(i >= 0) {
+          buffer[i] = value;
+          return true;
+        }
+        return Reflect.set(target, prop, value, receiver);
+      },
+      has(target, prop) {
+        return index(prop) >= 0 || Reflect.has(target, prop);
+      }
+    });
+  }
+
+  /**
+   * Returns matrix elements in column-major order for reading, strided views are copied.
+   * @returns {Array|Float64Array} Matrix elements.
+   */
+  #values() {
+    if(this.#native) {
+      var buffer = this.#native.buffer();
+      if(this.#native.isContiguous() && this.#native.getOffset() === 0 &&
+          buffer.length === this.rows * this.cols) {
+        return buffer;
+      }
+      return this.#native.toFloat64Array();
+    }
+    return this.#data;
+  }
+
+  /**
+   * Returns native strided array backing the matrix, plain data is moved into native array on first call.
+   * @returns {Object} Native array of shape [rows, cols].
+   */
+  native() {
+    if(!this.#native) {
+      this.#native = this.#jsl.inter.mat.ndarray(Float64Array.from(this.#data), 
+        [this.rows, this.cols]);
+      this.#data = null;
+    }
+    return this.#native;
+  }
+
+  /**
+   * Checks if the matrix is backed by native array.
+   * @returns {boolean} True for native backed matrix.
+   */
+  isNative() {
+    return this.#native !== null;
+  }
+
+  /**
+   * Creates copy-free view of the matrix, writes to the view change the matrix.
+   * @param {(Array<number>|_)} rows - Row range [first, last] or [first, last, step], or _ for all rows.
+   * @param {(Array<number>|_)} cols - Column range [first, last] or [first, last, step], or _ for all columns.
+   * @returns {PRDC_JSLAB_MATRIX} Native backed view matrix.
+   */
+  view(rows, cols) {
+    var all_index = this.#jsl.context._;
+    var ranges = [[rows, this.rows], [cols, this.cols]].map(function([r, n]) {
+      if(r === all_index || typeof r === 'undefined') {
+        return [0, n, 1];
+      }
+      var step = r.length > 2 ? r[2] : 1;
+      return [r[0], r[1] + Math.sign(step), step];
+    });
+    return this.#jsl.inter.mat.new(this.native().view(
+      ranges.map((r) => r[0]), ranges.map((r) => r[1]), ranges.map((r) => r[2])));
+  }
+
   /**
    * Extracts a specific column from a matrix.
    * @param {number} index - The index of the column to extract.
    * @returns {Array} The extracted column as an array.
    */
   column(index) {
+    if(this.#native) {
+      return Array.from(this.#native.view([0, index], [this.rows, index + 1])
+        .toFloat64Array());
+    }
     return this.#jsl.inter.array.column(this.toArray(), index);
   }
 
@@ -209,6 +381,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {Array} The extracted row as an array.
    */
   row(index) {
+    if(this.#native) {
+      return Array.from(this.#native.view([index, 0], [index + 1, this.cols])
+        .toFloat64Array());
+    }
     return this.#jsl.inter.array.row(this.toArray(), index);
   }
   
@@ -249,7 +425,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The reshaped matrix.
    */
   reshape(rows, cols) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.reshape(this.data, 
+    if(this.#native) {
+      return this.#jsl.inter.mat.new(this.#native.copy().reshape([rows, cols]));
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.reshape(this.#values(), 
       rows, cols), rows, cols);
   }
   
@@ -284,6 +463,9 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The transposed matrix.
    */
   transpose() {
+    if(this.#native) {
+      return this.#jsl.inter.mat.new(this.#native.permute([1, 0]).copy());
+    }
     var out = new Array(this.rows * this.cols).fill(0);
     for(var i = 0; i < this.rows; i++) {
       for(var j = 0; j < this.cols; j++) {
@@ -298,7 +480,8 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The inverse matrix.
    */
   inv() {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.env.math.inv(this.toArray()));
+    var X = this.#jsl.inter.env.native_module.inv(Float64Array.from(this.#values()), this.rows);
+    return this.#jsl.inter.mat.new(Array.from(X), this.rows, this.cols);
   }
   
   /**
@@ -306,9 +489,80 @@ class PRDC_JSLAB_MATRIX {
    * @returns {number} The determinant.
    */
   det() {
-    return this.#jsl.inter.env.math.det(this.toArray());
+    return this.#jsl.inter.env.native_module.det(Float64Array.from(this.#values()), this.rows);
+  }
+  
+  /**
+   * Factorizes the matrix once for repeated solves.
+   * @param {string} [type='lu'] - Factorization type ('lu', 'qr', 'llt' or 'ldlt').
+   * @returns {Object} Native factorization with solve, inverse, det, rank and rcond methods.
+   */
+  factorize(type = 'lu') {
+    return this.#jsl.inter.env.native_module.factorize(Float64Array.from(this.#values()), 
+      this.rows, this.cols, type);
   }
 
+  /**
+   * Computes eigenvalues and eigenvectors of the matrix.
+   * @param {boolean} [symmetric] - Use symmetric solver, detected if omitted.
+   * @returns {Object} Object with values, values_imag, vectors and vectors_imag, eigenvectors are matrix columns.
+   */
+  eig(symmetric) {
+    var E = this.#jsl.inter.env.native_module.eig(Float64Array.from(this.#values()), 
+      this.rows, symmetric);
+    return {
+      values: Array.from(E.values),
+      values_imag: Array.from(E.valuesImag),
+      vectors: this.#jsl.inter.mat.new(Array.from(E.vectors), this.rows, this.rows),
+      vectors_imag: this.#jsl.inter.mat.new(Array.from(E.vectorsImag), this.rows, this.rows)
+    };
+  }
+  
+  /**
+   * Computes singular value decomposition A = U*diag(S)*V'.
+   * @param {boolean} [econ=true] - Compute economy size decomposition.
+   * @returns {Object} Object with U and V matrices and singular values S.
+   */
+  svd(econ = true) {
+    var R = this.#jsl.inter.env.native_module.svd(Float64Array.from(this.#values()), 
+      this.rows, this.cols, econ);
+    return {
+      U: this.#jsl.inter.mat.new(Array.from(R.U), R.rowsU, R.colsU),
+      S: Array.from(R.S),
+      V: this.#jsl.inter.mat.new(Array.from(R.V), R.rowsV, R.colsV)
+    };
+  }
+  
+  /**
+   * Computes Moore-Penrose pseudoinverse of the matrix.
+   * @param {number} [tol] - Singular values below tolerance are treated as zero.
+   * @returns {PRDC_JSLAB_MATRIX} The pseudoinverse.
+   */
+  pinv(tol) {
+    var X = this.#jsl.inter.env.native_module.pinv(Float64Array.from(this.#values()), 
+      this.rows, this.cols, tol);
+    return this.#jsl.inter.mat.new(Array.from(X), this.cols, this.rows);
+  }
+  
+  /**
+   * Computes rank of the matrix from singular values.
+   * @param {number} [tol] - Singular values below tolerance are treated as zero.
+   * @returns {number} The rank.
+   */
+  rank(tol) {
+    return this.#jsl.inter.env.native_module.rank(Float64Array.from(this.#values()), 
+      this.rows, this.cols, tol);
+  }
+  
+  /**
+   * Computes 2-norm condition number of the matrix.
+   * @returns {number} The condition number.
+   */
+  cond() {
+    return this.#jsl.inter.env.native_module.cond(Float64Array.from(this.#values()), 
+      this.rows, this.cols);
+  }
+  
   /**
    * Computes the trace of the matrix (sum of diagonal elements).
    * @returns {number} The trace of the matrix.
@@ -339,7 +593,8 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The exponential matrix.
    */
   expm() {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.env.math.expm(this.toArray())._data);
+    var X = this.#jsl.inter.env.native_module.expm(Float64Array.from(this.#values()), this.rows);
+    return this.#jsl.inter.mat.new(Array.from(X), this.rows, this.cols);
   }
   
   /**
@@ -348,7 +603,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   add(A) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.plus(this.data, A.data), 
+    if(this._useNative(A)) {
+      return this._nativeElementWise('add', A);
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.plus(this.#values(), A.data), 
       this.rows, this.cols);
   }
 
@@ -367,7 +625,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   subtract(A) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.minus(this.data, A.data), 
+    if(this._useNative(A)) {
+      return this._nativeElementWise('sub', A);
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.minus(this.#values(), A.data), 
       this.rows, this.cols);
   }
 
@@ -381,21 +642,29 @@ class PRDC_JSLAB_MATRIX {
   }
 
   /**
-   * Multiplies two matrices.
+   * Multiplies two matrices. Large products use native blocked GEMM.
    * @param {PRDC_JSLAB_MATRIX} A - The matrix to multiply with.
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   multiply(A) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.multiply(this.data, A.data, this.rows, this.cols, A.cols), this.rows, A.cols);
+    if(this.rows * this.cols * A.cols >= this.#jsl.inter.mat.native_threshold) {
+      var C = this.#jsl.inter.env.native_module.matmul(Float64Array.from(this.#values()), 
+        Float64Array.from(A.data), this.rows, this.cols, A.cols);
+      return this.#jsl.inter.mat.new(Array.from(C), this.rows, A.cols);
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.multiply(this.#values(), A.data, this.rows, this.cols, A.cols), this.rows, A.cols);
   }
   
   /**
-   * Solves a linear system.
+   * Solves a linear system, rectangular systems in least squares sense.
    * @param {PRDC_JSLAB_MATRIX} B - The right-hand side matrix.
    * @returns {PRDC_JSLAB_MATRIX} The solution matrix.
    */
   linsolve(B) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.linsolve(this.data, B.data, this.cols), this.rows, 1);
+    var nrhs = B.data.length / this.rows;
+    var X = this.#jsl.inter.env.native_module.linsolve(Float64Array.from(this.#values()), 
+      Float64Array.from(B.data), this.rows, this.cols, nrhs);
+    return this.#jsl.inter.mat.new(Array.from(X), this.cols, nrhs);
   }
   
   /**
@@ -404,11 +673,14 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   divideEl(A) {
+    if(this._useNative(A)) {
+      return this._nativeElementWise('div', A);
+    }
     if(this.#jsl.inter.mat.isMatrix(A)) {
-      return this.#jsl.inter.mat.new(this.#jsl.inter.array.divideEl(this.data, A.data), 
+      return this.#jsl.inter.mat.new(this.#jsl.inter.array.divideEl(this.#values(), A.data), 
         this.rows, this.cols);
     } else {
-      return this.#jsl.inter.mat.new(this.#jsl.inter.array.scale(this.data, 1 / A), 
+      return this.#jsl.inter.mat.new(this.#jsl.inter.array.scale(this.#values(), 1 / A), 
         this.rows, this.cols);
     }
   }
@@ -419,11 +691,14 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   multiplyEl(A) {
+    if(this._useNative(A)) {
+      return this._nativeElementWise('mul', A);
+    }
     if(this.#jsl.inter.mat.isMatrix(A)) {
-      return this.#jsl.inter.mat.new(this.#jsl.inter.array.multiplyEl(this.data, A.data), 
+      return this.#jsl.inter.mat.new(this.#jsl.inter.array.multiplyEl(this.#values(), A.data), 
         this.rows, this.cols);
     } else {
-      return this.#jsl.inter.mat.new(this.#jsl.inter.array.scale(this.data, A), 
+      return this.#jsl.inter.mat.new(this.#jsl.inter.array.scale(this.#values(), A), 
         this.rows, this.cols);
     }
   }
@@ -434,7 +709,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   powEl(p) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.powEl(this.data, p), 
+    if(this._useNative(p)) {
+      return this._nativeElementWise('pow', p);
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.powEl(this.#values(), p), 
       this.rows, this.cols);
   }
 
@@ -444,16 +722,126 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} The resulting matrix.
    */
   elementWise(func) {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.elementWise((a) => func(a), this.data), 
+    if(this.#native) {
+      return this.clone().elementWiseInPlace(func);
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.elementWise((a) => func(a), this.#values()), 
       this.rows, this.cols);
   }
   
+  /**
+   * Adds matrix or scalar to the matrix in place using native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The matrix or scalar to add.
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  addInPlace(A) {
+    this.native().apply('add', this._nativeOperand(A));
+    return this;
+  }
+
+  /**
+   * Subtracts matrix or scalar from the matrix in place using native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The matrix or scalar to subtract.
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  subtractInPlace(A) {
+    this.native().apply('sub', this._nativeOperand(A));
+    return this;
+  }
+
+  /**
+   * Multiplies each element by matrix or scalar in place using native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The matrix or scalar to multiply by.
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  multiplyElInPlace(A) {
+    this.native().apply('mul', this._nativeOperand(A));
+    return this;
+  }
+
+  /**
+   * Divides each element by matrix or scalar in place using native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The matrix or scalar to divide by.
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  divideElInPlace(A) {
+    this.native().apply('div', this._nativeOperand(A));
+    return this;
+  }
+
+  /**
+   * Raises each element to a power in place using native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} p - The exponent.
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  powElInPlace(p) {
+    this.native().apply('pow', this._nativeOperand(p));
+    return this;
+  }
+
+  /**
+   * Applies a function to each element of the matrix in place.
+   * @param {(function|string)} func - The function to apply or name of native operation ('neg', 'abs', 'sqrt', 'exp', 'log', 'sin', 'cos', 'tan', 'round', 'floor', 'ceil' or 'reciprocal').
+   * @returns {PRDC_JSLAB_MATRIX} This matrix.
+   */
+  elementWiseInPlace(func) {
+    var X = this.native();
+    if(typeof func === 'string') {
+      X.map(func);
+    } else {
+      var data = X.toFloat64Array();
+      for(var i = 0; i < data.length; i++) {
+        data[i] = func(data[i]);
+      }
+      X.apply('set', data);
+    }
+    return this;
+  }
+
+  /**
+   * Checks if elementwise operation with operand should use native backing.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The operand.
+   * @returns {boolean} True if matrix or operand is native backed.
+   */
+  _useNative(A) {
+    return this.#native !== null || 
+      (this.#jsl.inter.mat.isMatrix(A) && A.isNative());
+  }
+
+  /**
+   * Converts operand of elementwise operation for native array.
+   * @param {PRDC_JSLAB_MATRIX|number} A - The operand.
+   * @returns {(Object|Array|number)} Native array, data array or scalar.
+   */
+  _nativeOperand(A) {
+    if(this.#jsl.inter.mat.isMatrix(A)) {
+      return A.isNative() ? A.native() : A.data;
+    }
+    return A;
+  }
+
+  /**
+   * Applies native elementwise operation to copy of the matrix.
+   * @param {string} op - Operation ('add', 'sub', 'mul', 'div' or 'pow').
+   * @param {PRDC_JSLAB_MATRIX|number} A - The operand.
+   * @returns {PRDC_JSLAB_MATRIX} The resulting native backed matrix.
+   */
+  _nativeElementWise(op, A) {
+    var X = this.#native ? this.#native.copy() : 
+      this.#jsl.inter.mat.ndarray(Float64Array.from(this.#data), [this.rows, this.cols]);
+    X.apply(op, this._nativeOperand(A));
+    return this.#jsl.inter.mat.new(X);
+  }
+
   /**
    * Computes the reciprocal of each element in the matrix.
    * @returns {PRDC_JSLAB_MATRIX} The matrix with reciprocals.
    */
   reciprocal() {
-    return this.#jsl.inter.mat.new(this.#jsl.inter.array.reciprocal(this.data, this.rows * this.cols), 
+    if(this.#native) {
+      return this.#jsl.inter.mat.new(this.#native.copy().map('reciprocal'));
+    }
+    return this.#jsl.inter.mat.new(this.#jsl.inter.array.reciprocal(this.#values(), this.rows * this.cols), 
       this.rows, this.cols);
   }
   
@@ -470,8 +858,10 @@ class PRDC_JSLAB_MATRIX {
    * @param {string} [order='asc'] - The order of sorting ('asc' or 'desc').
    * @returns {PRDC_JSLAB_MATRIX} The sorted matrix.
    */
-  sort() {
-    return this.#jsl.inter.env.math.sort(this.data);
+  sort(order = 'asc') {
+    var descending = ['desc', 'descend'].includes(order);
+    return Array.from(this.#jsl.inter.env.native_module.sort(this.#values(), 1, 
+      descending).y);
   }
 
   /**
@@ -479,7 +869,7 @@ class PRDC_JSLAB_MATRIX {
    * @returns {number} The minimum value.
    */
   min() {
-    return this.#jsl.inter.env.math.min(this.toArray());
+    return this._extreme(false);
   }
 
   /**
@@ -487,7 +877,27 @@ class PRDC_JSLAB_MATRIX {
    * @returns {number} The maximum value.
    */
   max() {
-    return this.#jsl.inter.env.math.max(this.toArray());
+    return this._extreme(true);
+  }
+
+  /**
+   * Finds the minimum or maximum element in a single pass over matrix data.
+   * @param {boolean} maximum - True to find the maximum.
+   * @returns {number} The extreme value, NaN if matrix contains NaN.
+   */
+  _extreme(maximum) {
+    var data = this.#values();
+    var value = maximum ? -Infinity : Infinity;
+    for(var i = 0; i < data.length; i++) {
+      var a = data[i];
+      if(Number.isNaN(a)) {
+        return NaN;
+      }
+      if(maximum ? a > value : a < value) {
+        value = a;
+      }
+    }
+    return value;
   }
   
   /**
@@ -495,7 +905,10 @@ class PRDC_JSLAB_MATRIX {
    * @returns {PRDC_JSLAB_MATRIX} A cloned matrix instance.
    */
   clone() {
-    return this.#jsl.inter.mat.new(this.data, this.rows, this.cols);
+    if(this.#native) {
+      return this.#jsl.inter.mat.new(this.#native.copy());
+    }
+    return this.#jsl.inter.mat.new(this.#values(), this.rows, this.cols);
   }
 
   /**
@@ -560,14 +973,23 @@ class PRDC_JSLAB_MATRIX {
       B = A[1];
     }
     
+    var values = new Array(indices.length);
+    var B_data = this.#jsl.inter.mat.isMatrix(B[0]) ? B[0].data : null;
     var j = 0;
     for(var i = 0; i < indices.length; i++) {
-      if(this.#jsl.inter.mat.isMatrix(B[0])) {
-        this.data[indices[i]] = B[0].data[j++];
+      if(B_data) {
+        values[i] = B_data[j++];
       } else if(Array.isArray(B) && B.length == indices.length) {
-        this.data[indices[i]] = B[j++];
+        values[i] = B[j++];
       } else {
-        this.data[indices[i]] = B[0];
+        values[i] = B[0];
+      }
+    }
+    if(this.#native) {
+      this.#native.scatter(indices, values);
+    } else {
+      for(var i = 0; i < indices.length; i++) {
+        this.#data[indices[i]] = values[i];
       }
     }
   }
@@ -607,6 +1029,13 @@ class PRDC_JSLAB_MATRIX {
       indices = this.index(A[0], A[1]);
     }
     
+    if(this.#native) {
+      if(indices === all_index) {
+        indices = this.#jsl.inter.array.range(0, this.rows * this.cols - 1);
+      }
+      return this.#jsl.inter.mat.new(Array.from(this.#native.gather(indices)), 
+        rows, cols);
+    }
     var B = this.#jsl.inter.array.createFilledArray(indices.length, 0);
     var j = 0;
     for(var i = 0; i < indices.length; i++) {
@@ -620,7 +1049,8 @@ class PRDC_JSLAB_MATRIX {
    * @returns {Array} The matrix data as a two-dimensional array.
    */
   toArray() {
-    return this.#jsl.inter.array.reshape(this.data, this.rows, this.cols);
+    return this.#jsl.inter.array.reshape(this.#native ? Array.from(this.#values()) : 
+      this.#values(), this.rows, this.cols);
   }
   
   /**
@@ -628,7 +1058,7 @@ class PRDC_JSLAB_MATRIX {
    * @returns {Array} The matrix data as a one-dimensional array.
    */
   toFlatArray() {
-    return this.data;
+    return this.#native ? Array.from(this.#values()) : this.#values();
   }
   
   /**
@@ -637,10 +1067,11 @@ class PRDC_JSLAB_MATRIX {
    */
   toString() {
     var str = 'Matrix([ \n';
+    var data = this.#values();
     for(var i = 0; i < this.rows; i++) {
       str += '  [';
       for(var j = 0; j < this.cols; j++) {
-        str += this.data[j * this.rows + i] + ', ';
+        str += data[j * this.rows + i] + ', ';
       }
       str = str.slice(0, -2);
       str += '],\n';
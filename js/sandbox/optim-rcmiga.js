@@ -54,7 +54,7 @@ class PRDC_JSLAB_OPTIM_RCMIGA {
     this.state.RandSeed = 'rcmiga';
     this.state.Generation = 0;
 
-    this.rand = this.inter.seedRandom(this.state.RandSeed);
+    this.rand = this.inter.rng(this.state.RandSeed);
   }
 
   /**
@@ -1539,9 +1539,9 @@ class PRDC_JSLAB_TABLE {
   }
 
   /**
-   * Sorts rows by variable.
-   * @param {(string|number)} by Variable name or column index.
-   * @param {string} [direction='asc'] Sort direction.
+   * Sorts rows by variable or by several variables.
+   * @param {(string|number|Array<(string|number)>)} by Variable name, column index or list of them.
+   * @param {(string|Array<string>)} [direction='asc'] Sort direction or one direction per variable.
    * @returns {PRDC_JSLAB_TABLE}
    */
   sortrows(by, direction = 'asc') {
@@ -1549,6 +1549,18 @@ class PRDC_JSLAB_TABLE {
       return this.subsetRows([]);
     }
 
+    if(Array.isArray(by)) {
+      var getters = by.map((key) => {
+        var name = typeof key === 'number' ? this.VariableNames[key] : String(key);
+        if(!name || !this.hasVariable(name)) {
+          throw new Error(this.jsl.currentString(487));
+        }
+        return (row_index) => this._columns[name][row_index];
+      });
+      return this.subsetRows(this.jsl.inter.format.buildSortedIndicesMulti(
+        this.height(), getters, direction));
+    }
+
     var key_name;
     if(typeof by === 'undefined' || by === null) {
       key_name = this.VariableNames[0];
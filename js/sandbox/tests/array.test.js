@@ -54,6 +54,62 @@ tests.add('dotVector computes scalar product', function(assert) {
   assert.equal(jsl.array.dotVector([1, 2, 3], [4, 5, 6]), 32);
 }, { tags: ['unit', 'array'] });
 
+tests.add('moving statistics follow MATLAB windows and endpoints', function(assert) {
+  var A = [4, 8, 6, -1, -2, -3, -1, 3, 4, 5];
+  assert.deepEqual(jsl.array.movmean(A, 3), 
+    [6, 6, 13 / 3, 1, -2, -2, -1 / 3, 2, 4, 4.5]);
+  assert.deepEqual(jsl.array.movsum(A, [2, 0], { endpoints: 'discard' }), 
+    [18, 13, 3, -6, -6, -1, 6, 12]);
+  assert.deepEqual(jsl.array.movmax(A, 2), [4, 8, 8, 6, -1, -2, -1, 3, 4, 5]);
+  assert.deepEqual(jsl.array.movmin([1, 2, 3, 4], 3, { endpoints: 'fill' }), 
+    [NaN, 1, 2, NaN]);
+  assert.deepEqual(jsl.array.movmedian(A, 4), 
+    [6, 6, 5, 2.5, -1.5, -1.5, -1.5, 1, 3.5, 4]);
+  var s = jsl.array.movstd(new Float64Array([2, 2, 2, 2, 5, 8]), 3);
+  assert.ok(s instanceof Float64Array);
+  assert.equal(s[1], 0);
+  assert.approx(s[4], 3, 1e-12);
+  var m = jsl.array.movmean(new Float64Array([1, 2, 3, 10, 20, 30]), 2, 
+    { channels: 2 });
+  assert.deepEqual(Array.from(m), [1, 1.5, 2.5, 10, 15, 25]);
+  assert.deepEqual(jsl.array.averageMoving([1, 2, 3, 4], 2), [1.5, 2, 3, 3.5]);
+}, { tags: ['unit', 'array'] });
+
+tests.add('describe and histcounts summarize data in single pass', function(assert) {
+  var d = jsl.array.describe([2, 4, NaN, 4, 4, 5, 5, 7, 9]);
+  assert.equal(d.count, 8);
+  assert.equal(d.nanCount, 1);
+  assert.approx(d.mean, 5, 1e-12);
+  assert.approx(d.var, 32 / 7, 1e-12);
+  assert.approx(d.skewness, 0.65625, 1e-12);
+  assert.approx(d.kurtosis, 2.78125, 1e-12);
+  assert.equal(d.min, 2);
+  assert.equal(d.max, 9);
+  var c = jsl.array.describe(new Float64Array([1, 2, 3, 10, 10, 10]), 2);
+  assert.deepEqual(c.mean, [2, 10]);
+  assert.deepEqual(c.std, [1, 0]);
+  var [N, edges] = jsl.array.histcounts([0, 0.5, 1, 1.5, 2, 2, NaN], 4);
+  assert.deepEqual(edges, [0, 0.5, 1, 1.5, 2]);
+  assert.deepEqual(N, [1, 1, 1, 3]);
+  var [Ninf, edges_inf] = jsl.array.histcounts([0, 1, 2, Infinity, -Infinity], 2);
+  assert.deepEqual(edges_inf, [0, 1, 2]);
+  assert.deepEqual(Ninf, [1, 2]);
+  var [P] = jsl.array.histcounts([1, 2, 3, 10], [0, 2, 5], 
+    { Normalization: 'probability' });
+  assert.deepEqual(P, [0.25, 0.5]);
+}, { tags: ['unit', 'array'] });
+
+tests.add('sorti, argsort and prctile sort numeric data natively', function(assert) {
+  assert.deepEqual(jsl.array.sorti([3, NaN, 1, 3, -2]), 
+    [[-2, 1, 3, 3, NaN], [4, 2, 0, 3, 1]]);
+  assert.deepEqual(jsl.array.argsort([2, 1, NaN, 1], 'descend'), [2, 0, 1, 3]);
+  var keys = new Float64Array([1, 0, 1, 0, 5, 7, 6, 7]);
+  assert.deepEqual(Array.from(jsl.array.argsort(keys, ['ascend', 'descend'], 2)), 
+    [1, 3, 2, 0]);
+  assert.equal(jsl.array.prctile([3, 1, NaN, 4, 1, 5, 9, 2, 6], 50), 3.5);
+  assert.deepEqual(jsl.array.prctile([1, 2, 3, 4], [0, 25, 100]), [1, 1.5, 4]);
+}, { tags: ['unit', 'array'] });
+
 tests.add('transpose2D transposes row-major matrix', function(assert) {
   var out = jsl.array.transpose2D([[1, 2, 3], [4, 5, 6]]);
   assert.deepEqual(out, [[1, 4], [2, 5], [3, 6]]);
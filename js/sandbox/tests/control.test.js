@@ -66,17 +66,73 @@ tests.add('tf2ss builds canonical companion-form state-space model', function(as
   assert.equal(sys.D, 0);
 }, { tags: ['unit', 'control'] });
 
-tests.add('lsim computes difference-equation response with internal normalization', function(assert) {
+tests.add('lsim passes transfer function coefficients to native lsim', function(assert) {
   var harness = createControlHarness();
+  var args = null;
+  harness.jsl.inter.env = {
+    native_module: {
+      lsim: function(num, den, u) {
+        args = [num, den, u];
+        return new Float64Array([0, 1, 1.5, 1.75]);
+      }
+    }
+  };
   var sys = { num: [1], den: [1, -0.5], Ts: 1 };
   var u = [1, 1, 1, 1];
   var t = [0, 1, 2, 3];
   var response = harness.control.lsim(sys, u, t, 1);
 
+  assert.ok(args[0] instanceof Float64Array);
+  assert.deepEqual(Array.from(args[0]), [1]);
+  assert.deepEqual(Array.from(args[1]), [1, -0.5]);
+  assert.deepEqual(Array.from(args[2]), u);
   assert.deepEqual(response.t, t);
   assert.deepEqual(response.y, [0, 1, 1.5, 1.75]);
 }, { tags: ['unit', 'control'] });
 
+tests.add('lsim step response of first-order system matches analytic solution', function(assert) {
+  // G(s) = 1/(tau*s + 1), zero-order hold is exact for step input
+  var tau = 0.5;
+  var Ts = 0.1;
+  var t = [];
+  var u = [];
+  for(var k = 0; k <= 40; k++) {
+    t.push(k * Ts);
+    u.push(1);
+  }
+  var response = jsl.control.lsim({ num: [1], den: [tau, 1] }, u, t, Ts);
+  for(var k = 0; k < t.length; k++) {
+    assert.approx(response.y[k], 1 - Math.exp(-t[k] / tau), 1e-10);
+  }
+
+  var sysd = { num: [1], den: [1, -0.5], Ts: 1 };
+  response = jsl.control.lsim(sysd, [1, 1, 1, 1], [0, 1, 2, 3], 1);
+  assert.deepEqual(response.y, [0, 1, 1.5, 1.75]);
+}, { tags: ['unit', 'control'] });
+
+tests.add('lsimBatch aligns coefficients of systems with different orders', function(assert) {
+  var harness = createControlHarness();
+  var args = null;
+  harness.jsl.inter.env = {
+    native_module: {
+      lsimBatch: function(nums, dens, u, count) {
+        args = [nums, dens, u, count];
+        return new Float64Array([1, 2, 3, 4]);
+      }
+    }
+  };
+  var systems = [
+    { num: [1], den: [1, -0.5], Ts: 1 },
+    { num: [2, 1], den: [1, 0.2, 0.1], Ts: 1 }
+  ];
+  var response = harness.control.lsimBatch(systems, [1, 1], [0, 1]);
+
+  assert.deepEqual(Array.from(args[0]), [0, 1, 0, 0, 2, 1]);
+  assert.deepEqual(Array.from(args[1]), [1, -0.5, 0, 1, 0.2, 0.1]);
+  assert.equal(args[3], 2);
+  assert.deepEqual(response.y, [[1, 2], [3, 4]]);
+}, { tags: ['unit', 'control'] });
+
 tests.add('step builds default unit input/time vectors and delegates to lsim', function(assert) {
   var harness = createControlHarness();
   var captured = null;
@@ -124,4 +180,122 @@ tests.add('c2d delegates through tf2ss, _c2dZOH, and ss2tf in order', function(a
   assert.equal(calls[2][0], 'ss2tf');
 }, { tags: ['unit', 'control'] });
 
+tests.add('_c2dNative passes column-major matrices to native c2d', function(assert) {
+  var harness = createControlHarness();
+  var args = null;
+  harness.jsl.inter.env = {
+    native_module: {
+      c2d: function() {
+        args = Array.from(arguments);
+        return {
+          A: new Float64Array([1, 3, 2, 4]),
+          B: new Float64Array([5, 6]),
+          C: new Float64Array([7, 8]),
+          D: new Float64Array([9])
+        };
+      }
+    }
+  };
+
+  var sysd = harness.control._c2dNative(
+    { A: [[0, 1], [-2, -3]], B: [0, 1], C: [1, 0], D: 0 }, 0.1, 'tustin');
+  assert.deepEqual(Array.from(args[0]), [0, -2, 1, -3]);
+  assert.deepEqual(Array.from(args[1]), [0, 1]);
+  assert.deepEqual(args.slice(4), [2, 1, 1, 0.1, 'tustin']);
+  assert.deepEqual(sysd, {
+    A: [[1, 2], [3, 4]],
+    B: [[5], [6]],
+    C: [7, 8],
+    D: 9,
+    Ts: 0.1
+  });
+}, { tags: ['unit', 'control'] });
+
+tests.add('tfest delegates LM and NelderMead fitting to native tfest', function(assert) {
+  var harness = createControlHarness({
+    mean: function(values) {
+      return values.reduce(function(a, b) { return a + b; }, 0) / values.length;
+    },
+    diff: function(values) {
+      return values.slice(1).map(function(v, i) { return v - values[i]; });
+    },
+    tf: function(num, den) {
+      return { num: num, den: den, Ts: 0 };
+    }
+  });
+  var args = null;
+  harness.jsl.inter.env = {
+    native_module: {
+      tfest: function() {
+        args = Array.from(arguments);
+        return {
+          num: new Float64Array([2]),
+          den: new Float64Array([1, 0.6, 2]),
+          mse: 0.01,
+          fit: 95,
+          iterations: 7
+        };
+      }
+    }
+  };
+
+  var result = harness.control.tfest([0, 0.5, 1], [1, 1, 1], [0, 0.1, 0.3], 2, 0, 'LM');
+  assert.deepEqual(Array.from(args[0]), [1, 1, 1]);
+  assert.deepEqual(Array.from(args[1]), [0, 0.1, 0.3]);
+  assert.deepEqual(args.slice(2, 6), [0.5, 2, 0, 'lm']);
+  assert.deepEqual(result.sys, { num: [2], den: [1, 0.6, 2], Ts: 0 });
+  assert.equal(result.error, 0.01);
+  assert.equal(result.fit, 95);
+  assert.equal(result.iterations, 7);
+}, { tags: ['unit', 'control'] });
+
+tests.add('c2d foh and tustin match analytic first-order discretization', function(assert) {
+  // G(s) = 1/(s + a)
+  var a = 2;
+  var Ts = 0.1;
+  var p = Math.exp(-a * Ts);
+  var expected = {
+    foh: {
+      num: [(a * Ts - 1 + p) / (a * a * Ts), (1 - p - a * Ts * p) / (a * a * Ts)],
+      den: [1, -p]
+    },
+    tustin: {
+      num: [Ts / (2 + a * Ts), Ts / (2 + a * Ts)],
+      den: [1, -(2 - a * Ts) / (2 + a * Ts)]
+    }
+  };
+  Object.keys(expected).forEach(function(method) {
+    var sysd = jsl.control.c2d([1], [1, a], Ts, method);
+    var num = sysd.num.slice(-2);
+    var den = sysd.den.map(function(v) { return v / sysd.den[0]; });
+    num = num.map(function(v) { return v / sysd.den[0]; });
+    assert.equal(den.length, 2);
+    for(var i = 0; i < 2; i++) {
+      assert.approx(num[i], expected[method].num[i], 1e-12);
+      assert.approx(den[i], expected[method].den[i], 1e-12);
+    }
+  });
+}, { tags: ['unit', 'control'] });
+
+tests.add('tfest recovers first-order system from simulated response', function(assert) {
+  // G(s) = 4/(s + 2), square wave input
+  var Ts = 0.05;
+  var t = [];
+  var u = [];
+  for(var k = 0; k < 200; k++) {
+    t.push(k * Ts);
+    u.push(Math.floor(k / 50) % 2 ? -1 : 1);
+  }
+  var y = jsl.control.lsim({ num: [4], den: [1, 2] }, u, t, Ts).y;
+  var result = jsl.control.tfest(t, u, y, 1, 0, 'LM');
+  assert.approx(result.sys.den[0], 1, 1e-12);
+  assert.approx(result.sys.den[1], 2, 1e-6);
+  assert.approx(result.sys.num[0], 4, 1e-6);
+  assert.ok(result.fit > 99.99);
+
+  var zeros = new Array(50).fill(0);
+  var flat = jsl.control.tfest(t.slice(0, 50), zeros, zeros, 1, 0, 'LM');
+  assert.equal(flat.fit, 100);
+}, { tags: ['unit', 'control'] });
+
 exports.MODULE_TESTS = tests;
@@ -170,4 +170,112 @@ tests.add('line overlap and minimum point distance utilities behave correctly',
   assert.deepEqual(min_dist.P2, [1, 0, 0]);
 }, { tags: ['unit', 'geometry'] });
 
+tests.add('boundary2D finds area and closed boundary of unit square', function(assert) {
+  var points = [];
+  for(var i = 0; i <= 4; i++) {
+    for(var j = 0; j <= 4; j++) {
+      points.push([i / 4, j / 4]);
+    }
+  }
+  var [polylines, A] = jsl.geometry.boundary2D(points, 0);
+  assert.approx(A, 1, 1e-12);
+  assert.equal(polylines.length, 1);
+  var loop = polylines[0];
+  assert.equal(loop.length, 17);
+  assert.equal(loop[0], loop[16]);
+  assert.equal(new Set(loop).size, 16);
+  loop.forEach(function(idx) {
+    var [x, y] = points[idx];
+    assert.ok(x === 0 || x === 1 || y === 0 || y === 1);
+  });
+}, { tags: ['unit', 'geometry'] });
+
+tests.add('estimateNormals3D gives plane normal for points on a plane', function(assert) {
+  var points = [];
+  for(var i = 0; i < 10; i++) {
+    for(var j = 0; j < 10; j++) {
+      points.push([i / 9, j / 9, 0.25]);
+    }
+  }
+  var N = jsl.geometry.estimateNormals3D(points, 8);
+  assert.equal(N.length, 3 * points.length);
+  for(var i = 0; i < points.length; i++) {
+    assert.approx(N[3*i], 0, 1e-9);
+    assert.approx(N[3*i+1], 0, 1e-9);
+    assert.approx(Math.abs(N[3*i+2]), 1, 1e-9);
+  }
+}, { tags: ['unit', 'geometry'] });
+
+tests.add('renderBuffers3D returns per-vertex buffers of unit cube surface', function(assert) {
+  // Lattice filling unit cube, shrink 0 gives convex hull
+  var points = [];
+  for(var i = 0; i <= 4; i++) {
+    for(var j = 0; j <= 4; j++) {
+      for(var k = 0; k <= 4; k++) {
+        points.push([i / 4, j / 4, k / 4]);
+      }
+    }
+  }
+  var result = jsl.geometry.renderBuffers3D(points, 0);
+  var nv = result.pointIndices.length;
+  assert.ok(nv > 0);
+  assert.equal(result.positions.length, 3 * nv);
+  assert.equal(result.normals.length, 3 * nv);
+  assert.ok(result.indices.length > 0);
+  assert.equal(result.indices.length % 3, 0);
+  assert.ok(Array.from(result.indices).every(function(v) { return v < nv; }));
+  for(var i = 0; i < nv; i++) {
+    var p = points[result.pointIndices[i]];
+    assert.approx(result.positions[3*i], p[0], 1e-6);
+    assert.approx(result.positions[3*i+1], p[1], 1e-6);
+    assert.approx(result.positions[3*i+2], p[2], 1e-6);
+  }
+}, { tags: ['unit', 'geometry'] });
+
+tests.add('slice3D cuts unit cube at mid-height into unit square', function(assert) {
+  // Lattice filling unit cube, shrink 0 gives convex hull
+  var points = [];
+  for(var i = 0; i <= 4; i++) {
+    for(var j = 0; j <= 4; j++) {
+      for(var k = 0; k <= 4; k++) {
+        points.push([i / 4, j / 4, k / 4]);
+      }
+    }
+  }
+  var sections = jsl.geometry.slice3D(points, [[0, 0, 1, -0.5]], 0);
+  assert.equal(sections.length, 1);
+  assert.approx(sections[0].area, 1, 1e-9);
+  assert.ok(sections[0].polylines.length > 0);
+  sections[0].polylines.forEach(function(pl) {
+    pl.forEach(function(p) {
+      assert.approx(p[2], 0.5, 1e-12);
+    });
+  });
+}, { tags: ['unit', 'geometry'] });
+
+tests.add('inShape3D classifies NaN as outside and grid matches exact classification', function(assert) {
+  // Lattice filling unit cube, shrink 0 gives convex hull
+  var points = [];
+  for(var i = 0; i <= 4; i++) {
+    for(var j = 0; j <= 4; j++) {
+      for(var k = 0; k <= 4; k++) {
+        points.push([i / 4, j / 4, k / 4]);
+      }
+    }
+  }
+  var tf = jsl.geometry.inShape3D(points, [[0.5, 0.5, 0.5], [2, 0.5, 0.5], 
+    [NaN, 0.5, 0.5], [0.5, Infinity, 0.5]], 0, 16);
+  assert.deepEqual(tf, [true, false, false, false]);
+
+  var query = [];
+  for(var q = 0; q < 2000; q++) {
+    query.push([1.4 * Math.sin(q * 12.9898) % 1 + 0.2, 
+      1.4 * Math.sin(q * 78.233) % 1 + 0.2, 1.4 * Math.sin(q * 37.719) % 1 + 0.2]);
+  }
+  var grid = jsl.geometry.inShape3D(points, query, 0, 16);
+  var exact = jsl.geometry.inShape3D(points, query, 0, 0);
+  assert.deepEqual(grid, exact);
+  assert.ok(exact.includes(true) && exact.includes(false));
+}, { tags: ['unit', 'geometry'] });
+
 exports.MODULE_TESTS = tests;
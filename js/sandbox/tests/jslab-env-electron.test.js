@@ -64,6 +64,12 @@ function loadEnvClass(runtime_scope) {
       if(module_path.endsWith('/build/Release/alpha_shape_3d')) {
         return { AlphaShape3D: class {} };
       }
+      if(module_path.endsWith('/build/Release/alpha_shape_2d')) {
+        return { AlphaShape2D: class {} };
+      }
+      if(module_path.endsWith('/build/Release/scattered_interpolant_2d')) {
+        return { ScatteredInterpolant2D: class {} };
+      }
       throw new Error('Unexpected require path: ' + module_path);
     }
   };
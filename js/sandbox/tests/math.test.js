@@ -26,6 +26,91 @@ tests.add('polyval evaluates polynomial coefficients', function(assert) {
   assert.deepEqual(y, [1, 0, 3]);
 }, { tags: ['unit', 'math'] });
 
+tests.add('polyfit and polyval fit centered polynomials with error estimates', function(assert) {
+  var x = [1000, 1001, 1002, 1003, 1004, 1005];
+  var y = x.map(function(v) { return 0.5 * (v - 1000) * (v - 1000) - 2 * v + 3; });
+  var p = jsl.math.polyfit([0, 1, 2, 3], [1, 0, 3, 10], 2);
+  assert.approx(p[0], 2, 1e-9);
+  assert.approx(p[1], -3, 1e-9);
+  assert.approx(p[2], 1, 1e-9);
+  var [pc, S, mu] = jsl.math.polyfitFull(x, y, 2, true);
+  assert.approx(mu[0], 1002.5, 1e-12);
+  assert.equal(S.df, 3);
+  assert.equal(S.rank, 3);
+  assert.ok(S.normr < 1e-9);
+  var [yq, delta] = jsl.math.polyval(pc, new Float64Array([1002, 1010]), S, mu);
+  assert.ok(yq instanceof Float64Array);
+  assert.approx(yq[1], 50 - 2017, 1e-6);
+  assert.ok(delta[0] >= 0 && delta[0] < 1e-6);
+  var fit = jsl.math.polyfitBatch([0, 1, 2, 3], [[1, 0, 3, 10], [0, 1, 2, 3]], 1);
+  assert.approx(fit.P[2], 1, 1e-12);
+  assert.approx(fit.P[3], 0, 1e-12);
+  var Y = jsl.math.polyvalBatch([[2, -3, 1], [1, 0, 0]], [0, 2]);
+  assert.deepEqual(Array.from(Y), [1, 3, 0, 4]);
+}, { tags: ['unit', 'math'] });
+
+tests.add('native FFT transforms and spectral estimates are consistent', function(assert) {
+  var X = jsl.math.fft1d([1, 2, 3, 4, 5]);
+  assert.approx(X.re[0], 15, 1e-12);
+  assert.approx(X.re[1], -2.5, 1e-12);
+  assert.approx(X.im[1], 3.440954801177933, 1e-12);
+  var x = new Float64Array(1000).map(function(v, k) { 
+    return Math.sin(0.3 * k) + 0.5 * Math.cos(1.1 * k); 
+  });
+  var R = jsl.math.rfft(x);
+  assert.equal(R.re.length, 501);
+  var y = jsl.math.irfft(R.re, R.im, 1000);
+  assert.approx(y[123], x[123], 1e-12);
+  var z = jsl.math.ifft1d(jsl.math.fft1d(x, null, 1009).re, 
+    jsl.math.fft1d(x, null, 1009).im);
+  assert.approx(z.re[999], x[999], 1e-12);
+  var [pxx, f] = jsl.math.periodogram(x, 'rectangular', 1000, 10);
+  var power = 0, energy = 0;
+  for(var k = 0; k < pxx.length; k++) {
+    power += pxx[k] * 10 / 1000;
+  }
+  for(var k = 0; k < x.length; k++) {
+    energy += x[k] * x[k] / x.length;
+  }
+  assert.approx(power, energy, 1e-9);
+  assert.approx(f[1], 0.01, 1e-12);
+  // Signal longer than nfft is wrapped, bins match every 4th full bin
+  var [pw] = jsl.math.periodogram(x, 'hann', 250, 10);
+  var [pf] = jsl.math.periodogram(x, 'hann', 1000, 10);
+  assert.equal(pw.length, 126);
+  for(var k = 0; k < pw.length; k++) {
+    assert.approx(pw[k], pf[4 * k], 1e-9);
+  }
+  var [S, fs, t, P] = jsl.math.spectrogram(x, 128, 64, 128);
+  assert.equal(S.re.length, fs.length * t.length);
+  assert.equal(P.length, S.re.length);
+}, { tags: ['unit', 'math'] });
+
+tests.add('native filtering carries state and convolution matches polynomial product', function(assert) {
+  var x = [1, 2, 3, 4, 5, 6];
+  var y = jsl.math.filter1d([1], [1, -0.5], x);
+  assert.approx(y[2], 3 + 0.5 * (2 + 0.5), 1e-12);
+  var [y1, zf] = jsl.math.filter1d([1, 1], [2], x.slice(0, 3), [0]);
+  var [y2] = jsl.math.filter1d([1, 1], [2], x.slice(3), zf);
+  assert.deepEqual(y1.concat(y2), [0.5, 1.5, 2.5, 3.5, 4.5, 5.5]);
+  assert.deepEqual(jsl.math.conv([1, 2], [1, 3, 1]), [1, 5, 7, 2]);
+  assert.deepEqual(jsl.math.conv([1, 2, 3], [1, 1, 1, 1], 'same'), [6, 6, 5]);
+  var [q, r] = jsl.math.deconv([1, 5, 7, 3], [1, 3, 1]);
+  assert.deepEqual(q, [1, 2]);
+  assert.deepEqual(r, [0, 0, 0, 1]);
+  var s = new Float64Array(400).map(function(v, k) { return Math.sin(0.01 * k); });
+  var yf = jsl.math.filtfilt([0.25, 0.5, 0.25], [1], s);
+  assert.approx(yf[200], s[200], 1e-3);
+  var yd = jsl.math.decimate(s, 4);
+  assert.equal(yd.length, 100);
+  assert.approx(yd[50], s[203], 1e-3);
+  var yr = jsl.math.resample(s, 3, 2);
+  assert.equal(yr.length, 600);
+  assert.approx(yr[300], s[200], 1e-3);
+  assert.throws(function() { jsl.math.decimate(s, NaN); }, /Decimation factor/);
+  assert.throws(function() { jsl.math.resample(s, 3, Infinity); }, /Resampling factors/);
+}, { tags: ['unit', 'math'] });
+
 tests.add('magnitude returns absolute magnitude', function(assert) {
   assert.equal(jsl.math.magnitude(-1234), 1234);
   assert.equal(jsl.math.magnitude({ real: 3, imag: 4 }), 5);
@@ -47,4 +132,121 @@ tests.add('mse computes mean squared error', function(assert) {
   assert.approx(jsl.math.mse([1, 2, 3], [1, 3, 2]), 2 / 3, 1e-12);
 }, { tags: ['unit', 'math'] });
 
+tests.add('trapz and simpson integrate matrix columns and rows', function(assert) {
+  // Columns y = x and y = x^2 sampled at x = 0, 1, 2
+  var A = jsl.mat.new([0, 1, 2, 0, 1, 4], 3, 2);
+  var T = jsl.math.trapz(A);
+  assert.deepEqual(T.data, [2, 3]);
+  var S = jsl.math.simpson(A);
+  assert.approx(S.data[0], 2, 1e-12);
+  assert.approx(S.data[1], 8 / 3, 1e-12);
+  var C = jsl.math.cumtrapz(A, undefined, 1);
+  assert.deepEqual(C.data, [0, 0, 0, 0, 1, 3]);
+  assert.approx(jsl.math.simpson([0, 1, 4, 9], [0, 1, 2, 3]), 9, 1e-12);
+}, { tags: ['unit', 'math'] });
+
+tests.add('trapz and cumtrapz give same result for Float64Array and Array input', function(assert) {
+  var x = [0, 0.5, 1.5, 2, 3];
+  var y = x.map(function(v) { return v * v; });
+  var X = Float64Array.from(x);
+  var Y = Float64Array.from(y);
+  assert.approx(jsl.math.trapz(Y, X), jsl.math.trapz(y, x), 1e-15);
+  assert.approx(jsl.math.trapz(Y), jsl.math.trapz(y), 1e-15);
+  assert.approx(jsl.math.trapz(y, x), 9.375, 1e-12);
+  assert.deepEqual(Array.from(jsl.math.cumtrapz(Y, X)), 
+    Array.from(jsl.math.cumtrapz(y, x)));
+
+  var out = new Float64Array(5);
+  var C = jsl.math.cumtrapz(Y, X, undefined, out);
+  assert.equal(C, out);
+  assert.deepEqual(Array.from(out), [0, 0.0625, 1.3125, 2.875, 9.375]);
+}, { tags: ['unit', 'math'] });
+
+tests.add('rootsBatch solves many polynomials with offsets', function(assert) {
+  var R = jsl.math.rootsBatch([[1, -3, 2], [0, 2, -4], [1, 0, 1]]);
+  assert.deepEqual(Array.from(R.offsets), [0, 2, 3, 5]);
+  var r1 = Array.from(R.real.subarray(0, 2)).sort();
+  assert.approx(r1[0], 1, 1e-12);
+  assert.approx(r1[1], 2, 1e-12);
+  assert.approx(R.real[2], 2, 1e-12);
+  assert.approx(Math.abs(R.imag[3]), 1, 1e-12);
+  assert.approx(R.imag[3] + R.imag[4], 0, 1e-12);
+}, { tags: ['unit', 'math'] });
+
+tests.add('interp1 supports linear, nearest and spline methods with extrapolation', function(assert) {
+  var x = [0, 1, 2.5, 3, 4.2, 5];
+  var y = x.map(function(v) { return v * v * v - 2 * v; });
+  assert.deepEqual(jsl.math.interp([0, 1, 1, 2], [0, 1, 5, 6], [1, 0.5, 1.5, 3]), 
+    [5, 0.5, 5.5, NaN]);
+  assert.approx(jsl.math.interp(x, y, -1, 'extrap'), 1, 1e-12);
+  assert.deepEqual(jsl.math.interp1(x, y, [0.5, 6], 'nearest', 'clamp'), [-1, 115]);
+  var yq = jsl.math.interp1(x, y, new Float64Array([1.7, 4.9, 6]), 'spline', 'extrap');
+  assert.ok(yq instanceof Float64Array);
+  assert.approx(yq[0], 1.513, 1e-9);
+  assert.approx(yq[1], 107.849, 1e-9);
+  assert.approx(yq[2], 204, 1e-9);
+}, { tags: ['unit', 'math'] });
+
+tests.add('gridData interpolates scattered plane samples on grid', function(assert) {
+  var x = [0, 1, 0, 1, 0.5, 0.2, 0.8];
+  var y = [0, 0, 1, 1, 0.5, 0.7, 0.3];
+  var z = x.map(function(v, i) { return 1 + 2 * v - y[i]; });
+  var [xq, yq, zq] = jsl.math.gridData(x, y, z, [0.25, 0.75, 2], [0.1, 0.6], 
+    'linear', { extrap: false });
+  assert.deepEqual(xq, [0.25, 0.75, 2]);
+  assert.equal(zq.length, 2);
+  assert.approx(zq[0][0], 1.4, 1e-12);
+  assert.approx(zq[1][1], 1.9, 1e-12);
+  assert.ok(Number.isNaN(zq[0][2]));
+  var [, , zc] = jsl.math.gridData(x, y, z, [0.25, 2], [0.1], 'cubic');
+  assert.approx(zc[0][0], 1.4, 1e-9);
+  assert.approx(zc[0][1], 4.9, 1e-9);
+  var [, , zn] = jsl.math.gridData(x, y, z, [0.1], [0.9], 'nearest');
+  assert.equal(zn[0][0], z[2]);
+}, { tags: ['unit', 'math'] });
+
+tests.add('gridData natural neighbor reproduces linear function up to convex hull', function(assert) {
+  var x = [0, 1, 0, 1, 0.5, 0.2, 0.8, 0.35, 0.65];
+  var y = [0, 0, 1, 1, 0.5, 0.7, 0.3, 0.15, 0.85];
+  var f = function(xi, yi) { return 1 + 2 * xi - yi; };
+  var z = x.map(function(v, i) { return f(v, y[i]); });
+  // Interior points, points close to hull edges, point on hull edge and data point
+  var queries = [[0.3, 0.4], [0.6, 0.55], [0.5, 1e-6], [0.5, 1e-3], 
+    [1e-4, 0.5], [0.999, 0.6], [0.5, 0], [0.35, 0.15]];
+  for(var i = 0; i < queries.length; i++) {
+    var [, , zq] = jsl.math.gridData(x, y, z, [queries[i][0]], [queries[i][1]], 
+      'natural', { extrap: false });
+    assert.approx(zq[0][0], f(queries[i][0], queries[i][1]), 1e-9);
+  }
+  var [, , zo] = jsl.math.gridData(x, y, z, [2], [0.5], 'natural', { extrap: false });
+  assert.ok(Number.isNaN(zo[0][0]));
+}, { tags: ['unit', 'math'] });
+
+tests.add('gridData averages values of repeated points', function(assert) {
+  var x = [0, 1, 0, 1, 0, 1];
+  var y = [0, 0, 1, 1, 0, 1];
+  var z = [1, 2, 3, 4, 3, 6];
+  var [, , zn] = jsl.math.gridData(x, y, z, [0.1, 0.9], [0.1, 0.9], 'nearest');
+  assert.deepEqual(zn, [[2, 2], [3, 5]]);
+  var [, , zl] = jsl.math.gridData(x, y, z, [0], [0], 'linear');
+  assert.approx(zl[0][0], 2, 1e-12);
+}, { tags: ['unit', 'math'] });
+
+tests.add('rng generates reproducible bulk random streams', function(assert) {
+  var a = jsl.math.rng(7).rand(100000, -1, 1);
+  var g = jsl.math.rng(7);
+  var b1 = g.rand(40000, -1, 1);
+  var b2 = g.rand(60000, -1, 1);
+  assert.equal(a[39999], b1[39999]);
+  assert.equal(a[40000], b2[0]);
+  assert.ok(a.every(function(v) { return v >= -1 && v < 1; }));
+  assert.ok(jsl.math.rng(7, 'philox', 1).rand(1)[0] !== a[0]);
+  var k = jsl.math.rng('seed').randi(1000, 3, 5);
+  assert.ok(k instanceof Int32Array);
+  assert.ok(k.every(function(v) { return v >= 3 && v <= 5; }));
+  var z = jsl.math.rng(1, 'xoshiro256pp').fill(new Float64Array(20000), 'normal', 2, 3);
+  var mean = z.reduce(function(s, v) { return s + v; }, 0) / z.length;
+  assert.approx(mean, 2, 0.1);
+}, { tags: ['unit', 'math'] });
+
 exports.MODULE_TESTS = tests;
@@ -44,6 +44,12 @@ tests.add('inv computes matrix inverse', function(assert) {
   assert.approx(prod[1][1], 1, 1e-10);
 }, { tags: ['unit', 'matrix'] });
 
+tests.add('inv throws for singular matrix', function(assert) {
+  assert.throws(function() {
+    jsl.mat.new([[1, 2], [2, 4]]).inv();
+  });
+}, { tags: ['unit', 'matrix'] });
+
 tests.add('linsolve solves linear system', function(assert) {
   // [2 1; 1 3] * [x;y] = [8;13] => x=2.2, y=3.6
   var A = jsl.mat.new([[2, 1], [1, 3]]);
@@ -67,4 +73,141 @@ tests.add('reshape preserves element order in column-major layout', function(ass
   assert.deepEqual(B.toArray(), [1, 3, 2, 4]);
 }, { tags: ['unit', 'matrix'] });
 
+tests.add('large multiply uses native GEMM with same result', function(assert) {
+  var N = 40;
+  var a = [];
+  var b = [];
+  for(var i = 0; i < N * N; i++) {
+    a.push(Math.sin(i));
+    b.push(Math.cos(i));
+  }
+  var A = jsl.mat.new(a, N, N);
+  var B = jsl.mat.new(b, N, N);
+  var C = A.multiply(B);
+  var C_js = jsl.array.multiply(a, b, N, N, N);
+  assert.equal(C.data.length, N * N);
+  for(var i = 0; i < N * N; i++) {
+    assert.approx(C.data[i], C_js[i], 1e-10);
+  }
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('factorize solves several right-hand sides without refactoring', function(assert) {
+  var A = jsl.mat.new([[4, 1], [1, 3]]);
+  var types = ['lu', 'qr', 'llt', 'ldlt'];
+  for(var t = 0; t < types.length; t++) {
+    var F = A.factorize(types[t]);
+    var X = F.solve(new Float64Array([1, 2, 5, 4]));
+    assert.approx(X[0], 1 / 11, 1e-12);
+    assert.approx(X[1], 7 / 11, 1e-12);
+    assert.approx(X[2], 1, 1e-12);
+    assert.approx(X[3], 1, 1e-12);
+  }
+  assert.approx(A.factorize('llt').det(), 11, 1e-12);
+  var B = jsl.mat.new([[1, 2], [3, 4]]);
+  assert.approx(B.factorize('lu').det(), -2, 1e-12);
+  assert.approx(B.factorize('qr').det(), -2, 1e-12);
+  var P = jsl.mat.new([[0, 1, 0], [1, 0, 0], [0, 0, 1]]);
+  assert.approx(P.factorize('qr').det(), -1, 1e-12);
+  assert.equal(A.factorize('qr').rank(), 2);
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('eig, svd, pinv, rank and cond use native decompositions', function(assert) {
+  var A = jsl.mat.new([[2, 1], [1, 2]]);
+  var E = A.eig();
+  assert.approx(E.values[0], 1, 1e-12);
+  assert.approx(E.values[1], 3, 1e-12);
+  var S = A.svd();
+  assert.approx(S.S[0], 3, 1e-12);
+  assert.approx(S.S[1], 1, 1e-12);
+  assert.approx(A.cond(), 3, 1e-12);
+  var B = jsl.mat.new([[1, 2], [2, 4], [3, 6]]);
+  assert.equal(B.rank(), 1);
+  var P = B.pinv();
+  assert.deepEqual(P.size(), [2, 3]);
+  var BPB = B.multiply(P).multiply(B);
+  for(var i = 0; i < 6; i++) {
+    assert.approx(BPB.data[i], B.data[i], 1e-12);
+  }
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('sparse matrix solves tridiagonal system with direct and iterative solvers', function(assert) {
+  var N = 50;
+  var I = [];
+  var J = [];
+  var V = [];
+  for(var i = 0; i < N; i++) {
+    I.push(i); J.push(i); V.push(2);
+    if(i > 0) {
+      I.push(i); J.push(i - 1); V.push(-1);
+      I.push(i - 1); J.push(i); V.push(-1);
+    }
+  }
+  var S = jsl.mat.sparse(I, J, V, N, N);
+  assert.equal(S.nnz(), 3 * N - 2);
+  var x = new Float64Array(N).map(function(v, i) { return Math.sin(i); });
+  var b = S.multiply(x);
+  var methods = ['ldlt', 'lu', 'cg', 'bicgstab'];
+  for(var m = 0; m < methods.length; m++) {
+    var y = S.solve(b, methods[m], { tol: 1e-14 });
+    for(var i = 0; i < N; i++) {
+      assert.approx(y[i], x[i], 1e-8);
+    }
+  }
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('native strided array views share data and operate in place', function(assert) {
+  var X = jsl.mat.ndarray(new Float64Array([1, 2, 3, 4, 5, 6]), [2, 3]);
+  var V = X.view([0, 1], [2, 3]);
+  assert.deepEqual(V.getShape(), [2, 2]);
+  V.apply('mul', 10);
+  assert.deepEqual(Array.from(X.buffer()), [1, 2, 30, 40, 50, 60]);
+  var T = X.permute([1, 0]);
+  assert.deepEqual(Array.from(T.toFloat64Array()), [1, 30, 50, 2, 40, 60]);
+  assert.throws(function() {
+    jsl.mat.ndarray(new Float64Array(4), [2, 2], [0, 2]);
+  });
+
+  var A = jsl.mat.new([[1, 2], [3, 4]]);
+  A.native();
+  assert.ok(A.isNative());
+  var B = A.add(A).powEl(2);
+  assert.deepEqual(B.toArray(), [[4, 16], [36, 64]]);
+  A.multiplyElInPlace(2).addInPlace(1);
+  assert.deepEqual(A.toArray(), [[3, 5], [7, 9]]);
+  var C = A.view([0, 1], [1, 1]);
+  C.elementWiseInPlace(function(x) { return -x; });
+  assert.deepEqual(A.column(1), [-5, -9]);
+  assert.deepEqual(A.transpose().toArray(), [[3, 7], [-5, -9]]);
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('data of strided matrix view writes through to parent', function(assert) {
+  var A = jsl.mat.new([[1, 2, 3], [4, 5, 6]]);
+  A.native();
+  var V = A.view(jsl.context._, [0, 2, 2]);
+  var data = V.data;
+  assert.equal(data.length, 4);
+  assert.deepEqual(Array.from(data), [1, 4, 3, 6]);
+  data[1] = -4;
+  V.data[3] = -6;
+  assert.deepEqual(A.toArray(), [[1, 2, 3], [-4, 5, -6]]);
+  assert.deepEqual(Array.from(V.data), [1, -4, 3, -6]);
+}, { tags: ['unit', 'matrix'] });
+
+tests.add('setSub with all index fills plain and native backed matrices', function(assert) {
+  var _ = jsl.context._;
+  var A = jsl.mat.new([[1, 2], [3, 4]]);
+  A.setSub(_, 7);
+  assert.deepEqual(A.toArray(), [[7, 7], [7, 7]]);
+  A.setSub(_, [1, 2, 3, 4]);
+  assert.deepEqual(A.data, [1, 2, 3, 4]);
+
+  var B = jsl.mat.new([[1, 2], [3, 4]]);
+  B.native();
+  B.setSub(_, 5);
+  assert.ok(B.isNative());
+  assert.deepEqual(B.toArray(), [[5, 5], [5, 5]]);
+  B.setSub(_, [4, 3, 2, 1]);
+  assert.deepEqual(Array.from(B.data), [4, 3, 2, 1]);
+}, { tags: ['unit', 'matrix'] });
+
 exports.MODULE_TESTS = tests;
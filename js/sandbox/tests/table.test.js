@@ -56,6 +56,14 @@ tests.add('sortrows sorts by selected variable', function(assert) {
   assert.deepEqual(S.getVariable('id'), [2, 3, 1]);
 }, { tags: ['unit', 'table'] });
 
+tests.add('sortrows sorts by several variables', function(assert) {
+  var T = jsl.table.table([2, 1, 2, 1], [5, 7, 6, 8],
+    { VariableNames: ['group', 'value'] });
+  var S = T.sortrows(['group', 'value'], ['asc', 'desc']);
+  assert.deepEqual(S.getVariable('group'), [1, 1, 2, 2]);
+  assert.deepEqual(S.getVariable('value'), [8, 7, 6, 5]);
+}, { tags: ['unit', 'table'] });
+
 tests.add('filter and rows return subsets', function(assert) {
   var T = makeSampleTable();
   var F = T.filter(function(row) {
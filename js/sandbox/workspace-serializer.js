@@ -527,7 +527,8 @@ class PRDC_JSLAB_WORKSPACE_SERIALIZER {
       return {
         rows: value.rows,
         cols: value.cols,
-        data: Array.isArray(value.data) ? value.data.slice() : []
+        data: Array.isArray(value.data) || ArrayBuffer.isView(value.data) ? 
+          Array.from(value.data) : []
       };
     }
     if(class_name === 'PRDC_JSLAB_VECTOR') {